@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/overset/OversetManager.H"
 #include "amr-wind/core/ExtSolver.H"
+#include "amr-wind/core/LoadBalancer.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -16,6 +17,7 @@ CFDSim::CFDSim(amrex::AmrCore& mesh)
     , m_io_mgr(new IOManager(*this))
     , m_post_mgr(new PostProcessManager(*this))
     , m_ext_solver_mgr(new ExtSolverMgr)
+    , m_load_balancer(new LoadBalancer(mesh))
 {}
 
 CFDSim::~CFDSim() = default;
@@ -67,6 +69,7 @@ void CFDSim::activate_mesh_map()
     if (m_mesh_mapping) {
         m_mesh_map = MeshMap::create(mesh_map_name);
         m_mesh_map->declare_mapping_fields(*this, m_pde_mgr.num_ghost_state());
+        m_repo.set_mesh_map(m_mesh_map.get());
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include "amr-wind/core/Field.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/core/MeshMap.H"
 #include "amr-wind/core/FieldFillPatchOps.H"
 #include "amr-wind/core/FieldBCOps.H"
 #include "amr-wind/core/SimTime.H"
@@ -236,6 +237,12 @@ void Field::fillphysbc(amrex::Real time) noexcept
     fillphysbc(time, num_grow());
 }
 
+bool Field::fill_by_exchange(int lev) const noexcept
+{
+    BL_ASSERT(m_info->m_fillpatch_op);
+    return m_info->m_fillpatch_op->fill_by_exchange(lev);
+}
+
 void Field::apply_bc_funcs(const FieldState rho_state) noexcept
 {
     BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
@@ -358,27 +365,21 @@ void Field::to_uniform_space() noexcept
         return;
     }
 
-    const auto& mesh_fac = m_repo.get_mesh_mapping_field(m_info->m_floc);
-    const auto& mesh_detJ = m_repo.get_mesh_mapping_detJ(m_info->m_floc);
+    const auto& mesh_map = m_repo.mesh_map();
+    const int ngrow = amrex::min(m_info->m_ngrow.max(), mesh_map.num_ghost());
 
     // scale velocity to accommodate for mesh mapping -> U^bar = U * J/fac
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
-        for (amrex::MFIter mfi(mesh_fac(lev)); mfi.isValid(); ++mfi) {
-
-            amrex::Array4<amrex::Real> const& field = operator()(lev).array(
-                mfi);
-            amrex::Array4<amrex::Real const> const& fac =
-                mesh_fac(lev).const_array(mfi);
-            amrex::Array4<amrex::Real const> const& detJ =
-                mesh_detJ(lev).const_array(mfi);
-
-            amrex::ParallelFor(
-                mfi.growntilebox(), AMREX_SPACEDIM,
-                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                    field(i, j, k, n) *= detJ(i, j, k) / fac(i, j, k, n);
-                });
-        }
+        const auto mv = mesh_map.view(lev, m_info->m_floc);
+        const auto& farrs = operator()(lev).arrays();
+        amrex::ParallelFor(
+            operator()(lev), amrex::IntVect(ngrow), AMREX_SPACEDIM,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                farrs[nbx](i, j, k, n) *=
+                    mv.detJ(nbx, i, j, k) / mv.fac(nbx, i, j, k, n);
+            });
     }
+    amrex::Gpu::synchronize();
     m_mesh_mapped = true;
 }
 
@@ -393,26 +394,21 @@ void Field::to_stretched_space() noexcept
         return;
     }
 
-    const auto& mesh_fac = m_repo.get_mesh_mapping_field(m_info->m_floc);
-    const auto& mesh_detJ = m_repo.get_mesh_mapping_detJ(m_info->m_floc);
+    const auto& mesh_map = m_repo.mesh_map();
+    const int ngrow = amrex::min(m_info->m_ngrow.max(), mesh_map.num_ghost());
 
     // scale field back to stretched mesh -> U = U^bar * fac/J
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
-        for (amrex::MFIter mfi(mesh_fac(lev)); mfi.isValid(); ++mfi) {
-            amrex::Array4<amrex::Real> const& field = operator()(lev).array(
-                mfi);
-            amrex::Array4<amrex::Real const> const& fac =
-                mesh_fac(lev).const_array(mfi);
-            amrex::Array4<amrex::Real const> const& detJ =
-                mesh_detJ(lev).const_array(mfi);
-
-            amrex::ParallelFor(
-                mfi.growntilebox(), AMREX_SPACEDIM,
-                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                    field(i, j, k, n) *= fac(i, j, k, n) / detJ(i, j, k);
-                });
-        }
+        const auto mv = mesh_map.view(lev, m_info->m_floc);
+        const auto& farrs = operator()(lev).arrays();
+        amrex::ParallelFor(
+            operator()(lev), amrex::IntVect(ngrow), AMREX_SPACEDIM,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                farrs[nbx](i, j, k, n) *=
+                    mv.fac(nbx, i, j, k, n) / mv.detJ(nbx, i, j, k);
+            });
     }
+    amrex::Gpu::synchronize();
     m_mesh_mapped = false;
 }
 
@@ -16,6 +16,8 @@ void FieldRepo::make_new_level_from_scratch(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_new_level_from_scratch");
+    m_scratch_pool->invalidate_level(lev);
+    m_scratch_arena->release();
     m_leveldata[lev] = std::make_unique<LevelDataHolder>();
 
     allocate_field_data(
@@ -33,6 +35,8 @@ void FieldRepo::make_new_level_from_coarse(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_level_from_coarse");
+    m_scratch_pool->invalidate_level(lev);
+    m_scratch_arena->release();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -57,6 +61,8 @@ void FieldRepo::remake_level(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::remake_level");
+    m_scratch_pool->invalidate_level(lev);
+    m_scratch_arena->release();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -77,6 +83,8 @@ void FieldRepo::remake_level(
 void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
+    m_scratch_pool->invalidate_level(lev);
+    m_scratch_arena->release();
     m_leveldata[lev].reset();
 }
 
@@ -159,56 +167,6 @@ FieldRepo::get_field(const std::string& name, const FieldState fstate) const
     return *m_field_vec[found->second];
 }
 
-Field& FieldRepo::get_mesh_mapping_field(FieldLoc floc) const
-{
-    Field* fac = nullptr;
-    switch (floc) {
-    case FieldLoc::CELL:
-        fac = &(get_field("mesh_scaling_factor_cc"));
-        break;
-    case FieldLoc::NODE:
-        fac = &(get_field("mesh_scaling_factor_nd"));
-        break;
-    case FieldLoc::XFACE:
-        fac = &(get_field("mesh_scaling_factor_xf"));
-        break;
-    case FieldLoc::YFACE:
-        fac = &(get_field("mesh_scaling_factor_yf"));
-        break;
-    case FieldLoc::ZFACE:
-        fac = &(get_field("mesh_scaling_factor_zf"));
-        break;
-    default:
-        amrex::Abort("Invalid field location");
-    }
-    return *fac;
-}
-
-Field& FieldRepo::get_mesh_mapping_detJ(FieldLoc floc) const
-{
-    Field* detJ = nullptr;
-    switch (floc) {
-    case FieldLoc::CELL:
-        detJ = &(get_field("mesh_scaling_detJ_cc"));
-        break;
-    case FieldLoc::NODE:
-        detJ = &(get_field("mesh_scaling_detJ_nd"));
-        break;
-    case FieldLoc::XFACE:
-        detJ = &(get_field("mesh_scaling_detJ_xf"));
-        break;
-    case FieldLoc::YFACE:
-        detJ = &(get_field("mesh_scaling_detJ_yf"));
-        break;
-    case FieldLoc::ZFACE:
-        detJ = &(get_field("mesh_scaling_detJ_zf"));
-        break;
-    default:
-        amrex::Abort("Invalid field location");
-    }
-    return *detJ;
-}
-
 bool FieldRepo::field_exists(
     const std::string& name, const FieldState fstate) const
 {
@@ -308,14 +266,16 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
 
     std::unique_ptr<ScratchField> field(
         new ScratchField(*this, name, ncomp, nghost, floc));
+    field->m_pool = m_scratch_pool;
 
     for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
         const auto ba =
             amrex::convert(m_mesh.boxArray(lev), field_impl::index_type(floc));
 
-        field->m_data.emplace_back(
-            ba, m_mesh.DistributionMap(lev), ncomp, nghost, amrex::MFInfo(),
-            *(m_leveldata[lev]->m_factory));
+        field->m_pool_gen.push_back(m_scratch_pool->generation(lev));
+        field->m_data.push_back(m_scratch_pool->acquire(
+            lev, ba, m_mesh.DistributionMap(lev), ncomp, nghost, floc,
+            *(m_leveldata[lev]->m_factory)));
     }
     return field;
 }
@@ -336,6 +296,58 @@ void FieldRepo::advance_states() noexcept
     }
 }
 
+void FieldRepo::fillpatch(
+    const amrex::Vector<Field*>& fields,
+    const amrex::Real time,
+    const amrex::IntVect& ng) const noexcept
+{
+    const amrex::Vector<amrex::IntVect> ngrow(fields.size(), ng);
+    fillpatch_impl(fields, time, ngrow);
+}
+
+void FieldRepo::fillpatch(
+    const amrex::Vector<Field*>& fields, const amrex::Real time) const noexcept
+{
+    amrex::Vector<amrex::IntVect> ngrow;
+    ngrow.reserve(fields.size());
+    for (const auto* fld : fields) {
+        ngrow.push_back(fld->num_grow());
+    }
+    fillpatch_impl(fields, time, ngrow);
+}
+
+void FieldRepo::fillpatch_impl(
+    const amrex::Vector<Field*>& fields,
+    const amrex::Real time,
+    const amrex::Vector<amrex::IntVect>& ngrow) const noexcept
+{
+    BL_PROFILE("amr-wind::FieldRepo::fillpatch");
+    const int nfields = fields.size();
+    for (int lev = 0; lev < num_active_levels(); ++lev) {
+        const auto period = m_mesh.Geom(lev).periodicity();
+
+        // Post the exchanges for all the fields before waiting on any of them
+        amrex::Vector<int> exchanged;
+        for (int i = 0; i < nfields; ++i) {
+            auto& fld = *fields[i];
+            auto& mfab = fld(lev);
+            if (fld.fill_by_exchange(lev)) {
+                mfab.FillBoundary_nowait(0, fld.num_comp(), ngrow[i], period);
+                exchanged.push_back(i);
+            } else {
+                fld.fillpatch(lev, time, mfab, ngrow[i]);
+            }
+        }
+
+        for (const int i : exchanged) {
+            auto& fld = *fields[i];
+            auto& mfab = fld(lev);
+            mfab.FillBoundary_finish();
+            fld.fillphysbc(lev, time, mfab, ngrow[i]);
+        }
+    }
+}
+
 void FieldRepo::allocate_field_data(
     const amrex::BoxArray& ba,
     const amrex::DistributionMapping& dm,
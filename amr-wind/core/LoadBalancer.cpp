@@ -0,0 +1,258 @@
+#include "amr-wind/core/LoadBalancer.H"
+
+#include <algorithm>
+
+#include "AMReX_GpuAtomic.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind {
+
+namespace {
+
+//! Cost of the flow solver work on a box
+amrex::Vector<amrex::Real> base_costs(const amrex::BoxArray& ba)
+{
+    amrex::Vector<amrex::Real> costs(ba.size());
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        costs[i] = static_cast<amrex::Real>(ba[i].numPts());
+    }
+    return costs;
+}
+
+/** Map box costs onto a new BoxArray
+ *
+ *  The work in excess of the flow solver cost is assumed to be uniformly
+ *  distributed within each old box and is apportioned to the new boxes based
+ *  on the number of overlapping cells.
+ */
+amrex::Vector<amrex::Real> remap_costs(
+    const amrex::BoxArray& old_ba,
+    const amrex::Vector<amrex::Real>& old_costs,
+    const amrex::BoxArray& new_ba)
+{
+    auto costs = base_costs(new_ba);
+    for (int i = 0; i < static_cast<int>(new_ba.size()); ++i) {
+        for (const auto& isect : old_ba.intersections(new_ba[i])) {
+            const int j = isect.first;
+            const auto npts = static_cast<amrex::Real>(old_ba[j].numPts());
+            const amrex::Real extra = amrex::max(old_costs[j] - npts, 0.0);
+            const auto nisect =
+                static_cast<amrex::Real>(isect.second.numPts());
+            costs[i] += extra * nisect / npts;
+        }
+    }
+    return costs;
+}
+
+} // namespace
+
+LoadBalancer::LoadBalancer(const amrex::AmrCore& mesh)
+    : m_mesh(mesh)
+    , m_costs(mesh.maxLevel() + 1)
+    , m_num_steps(mesh.maxLevel() + 1, 0)
+    , m_box_costs(mesh.maxLevel() + 1)
+    , m_grids(mesh.maxLevel() + 1)
+{
+    amrex::ParmParse pp("loadbalance");
+    pp.query("enabled", m_enabled);
+    pp.query("strategy", m_strategy);
+    pp.query("efficiency_threshold", m_threshold);
+    pp.query("interval", m_interval);
+    pp.query("verbose", m_verbose);
+
+    if ((m_strategy != "knapsack") && (m_strategy != "sfc")) {
+        amrex::Abort(
+            "LoadBalancer: Invalid strategy " + m_strategy +
+            ". Valid options are knapsack or sfc");
+    }
+}
+
+LoadBalancer::~LoadBalancer() = default;
+
+amrex::Real
+LoadBalancer::weight(const std::string& name, amrex::Real default_value)
+{
+    auto found = m_weights.find(name);
+    if (found != m_weights.end()) {
+        return found->second;
+    }
+
+    amrex::Real wt = default_value;
+    amrex::ParmParse pp("loadbalance");
+    pp.query((name + "_weight").c_str(), wt);
+    m_weights[name] = wt;
+    return wt;
+}
+
+void LoadBalancer::add_cost(int lev, const amrex::MFIter& mfi, amrex::Real cost)
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    AMREX_ASSERT(m_costs[lev]);
+    amrex::HostDevice::Atomic::Add(&(*m_costs[lev])[mfi], cost);
+}
+
+void LoadBalancer::end_timestep()
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    for (int lev = 0; lev < static_cast<int>(m_costs.size()); ++lev) {
+        if (m_costs[lev]) {
+            ++m_num_steps[lev];
+        }
+    }
+}
+
+void LoadBalancer::update_box_costs(int lev)
+{
+    BL_PROFILE("amr-wind::LoadBalancer::update_box_costs");
+
+    if (!m_costs[lev] || (m_num_steps[lev] < 1)) {
+        return;
+    }
+
+    auto& costs = *m_costs[lev];
+    const auto& ba = m_grids[lev];
+    amrex::Vector<amrex::Real> extra(ba.size(), 0.0);
+    for (amrex::MFIter mfi(costs); mfi.isValid(); ++mfi) {
+        extra[mfi.index()] = costs[mfi] / m_num_steps[lev];
+        costs[mfi] = 0.0;
+    }
+    amrex::ParallelDescriptor::ReduceRealSum(extra.data(), extra.size());
+
+    m_box_costs[lev] = base_costs(ba);
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        m_box_costs[lev][i] += extra[i];
+    }
+    m_num_steps[lev] = 0;
+}
+
+amrex::DistributionMapping LoadBalancer::make_distribution_map(
+    const amrex::BoxArray& ba,
+    const amrex::Vector<amrex::Real>& costs,
+    amrex::Real& efficiency) const
+{
+    if (m_strategy == "sfc") {
+        return amrex::DistributionMapping::makeSFC(costs, ba, efficiency);
+    }
+    return amrex::DistributionMapping::makeKnapSack(costs, efficiency);
+}
+
+amrex::Real LoadBalancer::efficiency(
+    const amrex::DistributionMapping& dm,
+    const amrex::Vector<amrex::Real>& costs)
+{
+    amrex::Vector<amrex::Real> rank_costs(
+        amrex::ParallelDescriptor::NProcs(), 0.0);
+    for (int i = 0; i < static_cast<int>(costs.size()); ++i) {
+        rank_costs[dm[i]] += costs[i];
+    }
+
+    const amrex::Real max_cost =
+        *std::max_element(rank_costs.begin(), rank_costs.end());
+    if (max_cost <= 0.0) {
+        return 1.0;
+    }
+
+    amrex::Real total = 0.0;
+    for (const auto cost : rank_costs) {
+        total += cost;
+    }
+    return total / (static_cast<amrex::Real>(rank_costs.size()) * max_cost);
+}
+
+amrex::DistributionMapping LoadBalancer::distribution_map(
+    int lev, const amrex::BoxArray& ba, const amrex::DistributionMapping& dm)
+{
+    BL_PROFILE("amr-wind::LoadBalancer::distribution_map");
+
+    // Nothing is known about new levels, use the default mapping
+    if (!m_enabled || m_grids[lev].empty()) {
+        return dm;
+    }
+
+    update_box_costs(lev);
+    const auto costs = remap_costs(m_grids[lev], m_box_costs[lev], ba);
+
+    amrex::Real eff = 0.0;
+    auto new_dm = make_distribution_map(ba, costs, eff);
+    if (m_verbose > 0) {
+        amrex::Print() << "Load balance level " << lev << ": efficiency = "
+                       << efficiency(dm, costs) << " (default) " << eff
+                       << " (cost-based)" << std::endl;
+    }
+    return new_dm;
+}
+
+bool LoadBalancer::check_imbalance(int time_index) const
+{
+    return m_enabled && (m_interval > 0) && (time_index % m_interval == 0);
+}
+
+bool LoadBalancer::rebalance_level(int lev, amrex::DistributionMapping& new_dm)
+{
+    BL_PROFILE("amr-wind::LoadBalancer::rebalance_level");
+
+    if (!m_enabled || !m_costs[lev] || (m_num_steps[lev] < 1)) {
+        return false;
+    }
+
+    update_box_costs(lev);
+    const auto& costs = m_box_costs[lev];
+    const amrex::Real current =
+        efficiency(m_mesh.DistributionMap(lev), costs);
+    if (current >= m_threshold) {
+        return false;
+    }
+
+    amrex::Real proposed = 0.0;
+    new_dm = make_distribution_map(m_grids[lev], costs, proposed);
+    if (proposed <= current) {
+        return false;
+    }
+
+    if (m_verbose > 0) {
+        amrex::Print() << "Rebalancing level " << lev
+                       << ": efficiency = " << current << " -> " << proposed
+                       << std::endl;
+    }
+    return true;
+}
+
+void LoadBalancer::reset_level(
+    int lev, const amrex::BoxArray& ba, const amrex::DistributionMapping& dm)
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    if (m_grids[lev].empty()) {
+        m_box_costs[lev] = base_costs(ba);
+    } else if (m_grids[lev] != ba) {
+        update_box_costs(lev);
+        m_box_costs[lev] = remap_costs(m_grids[lev], m_box_costs[lev], ba);
+    }
+    m_grids[lev] = ba;
+
+    m_costs[lev] = std::make_unique<amrex::LayoutData<amrex::Real>>(ba, dm);
+    for (amrex::MFIter mfi(*m_costs[lev]); mfi.isValid(); ++mfi) {
+        (*m_costs[lev])[mfi] = 0.0;
+    }
+    m_num_steps[lev] = 0;
+}
+
+void LoadBalancer::clear_level(int lev)
+{
+    m_costs[lev].reset();
+    m_num_steps[lev] = 0;
+    m_box_costs[lev].clear();
+    m_grids[lev] = amrex::BoxArray();
+}
+
+} // namespace amr_wind
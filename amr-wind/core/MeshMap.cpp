@@ -5,6 +5,18 @@ namespace amr_wind {
 
 void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
 {
+    m_nghost = nghost;
+
+    // Separable mappings only store 1-D arrays for every level
+    if (is_separable()) {
+        const int nlevels = sim.mesh().maxLevel() + 1;
+        m_fac_cc.resize(nlevels);
+        m_fac_nd.resize(nlevels);
+        m_coord_cc.resize(nlevels);
+        m_coord_nd.resize(nlevels);
+        m_lo.resize(nlevels);
+        return;
+    }
 
     // declare nodal, cell-centered, and face-centered mesh mapping array
     m_mesh_scale_fac_cc = &(sim.repo().declare_cc_field(
@@ -39,4 +51,120 @@ void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
     // TODO: Create BCNoOP fill patch operators for mesh scaling fields ?
 }
 
+void MeshMap::set_separable_map(
+    int lev,
+    const amrex::Geometry& geom,
+    int dir,
+    const amrex::Vector<amrex::Real>& fac_cc,
+    const amrex::Vector<amrex::Real>& fac_nd,
+    const amrex::Vector<amrex::Real>& coord_cc,
+    const amrex::Vector<amrex::Real>& coord_nd)
+{
+    const auto bx = separable_box(geom);
+    AMREX_ALWAYS_ASSERT(is_separable());
+    AMREX_ALWAYS_ASSERT(static_cast<int>(fac_cc.size()) == bx.length(dir));
+    AMREX_ALWAYS_ASSERT(fac_nd.size() == fac_cc.size() + 1);
+    AMREX_ALWAYS_ASSERT(coord_cc.size() == fac_cc.size());
+    AMREX_ALWAYS_ASSERT(coord_nd.size() == fac_nd.size());
+
+    auto copy_to_device = [](const amrex::Vector<amrex::Real>& src,
+                             amrex::Gpu::DeviceVector<amrex::Real>& dst) {
+        dst.resize(src.size());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, src.begin(), src.end(), dst.begin());
+    };
+
+    copy_to_device(fac_cc, m_fac_cc[lev][dir]);
+    copy_to_device(fac_nd, m_fac_nd[lev][dir]);
+    copy_to_device(coord_cc, m_coord_cc[lev][dir]);
+    copy_to_device(coord_nd, m_coord_nd[lev][dir]);
+    m_lo[lev][dir] = bx.smallEnd(dir);
+}
+
+const Field& MeshMap::fac_field(FieldLoc floc) const
+{
+    AMREX_ALWAYS_ASSERT(!is_separable());
+    switch (floc) {
+    case FieldLoc::CELL:
+        return *m_mesh_scale_fac_cc;
+    case FieldLoc::NODE:
+        return *m_mesh_scale_fac_nd;
+    case FieldLoc::XFACE:
+        return *m_mesh_scale_fac_xf;
+    case FieldLoc::YFACE:
+        return *m_mesh_scale_fac_yf;
+    case FieldLoc::ZFACE:
+        return *m_mesh_scale_fac_zf;
+    default:
+        amrex::Abort("Invalid field location");
+    }
+    return *m_mesh_scale_fac_cc;
+}
+
+const Field& MeshMap::detJ_field(FieldLoc floc) const
+{
+    AMREX_ALWAYS_ASSERT(!is_separable());
+    switch (floc) {
+    case FieldLoc::CELL:
+        return *m_mesh_scale_detJ_cc;
+    case FieldLoc::NODE:
+        return *m_mesh_scale_detJ_nd;
+    case FieldLoc::XFACE:
+        return *m_mesh_scale_detJ_xf;
+    case FieldLoc::YFACE:
+        return *m_mesh_scale_detJ_yf;
+    case FieldLoc::ZFACE:
+        return *m_mesh_scale_detJ_zf;
+    default:
+        amrex::Abort("Invalid field location");
+    }
+    return *m_mesh_scale_detJ_cc;
+}
+
+MeshMapView MeshMap::view(int lev, FieldLoc floc) const
+{
+    MeshMapView mv;
+    mv.separable = is_separable();
+
+    if (mv.separable) {
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            // Staggered directions use the values at the nodes
+            const bool nodal = (floc == FieldLoc::NODE) ||
+                               ((floc == FieldLoc::XFACE) && (dir == 0)) ||
+                               ((floc == FieldLoc::YFACE) && (dir == 1)) ||
+                               ((floc == FieldLoc::ZFACE) && (dir == 2));
+            mv.fac1d[dir] = nodal ? m_fac_nd[lev][dir].data()
+                                  : m_fac_cc[lev][dir].data();
+            mv.coord1d[dir] = nodal ? m_coord_nd[lev][dir].data()
+                                    : m_coord_cc[lev][dir].data();
+            mv.lo[dir] = m_lo[lev][dir];
+        }
+        return mv;
+    }
+
+    mv.fac3d = fac_field(floc)(lev).const_arrays();
+    mv.detJ3d = detJ_field(floc)(lev).const_arrays();
+    if (floc == FieldLoc::CELL) {
+        mv.coord3d = (*m_non_uniform_coord_cc)(lev).const_arrays();
+    } else if (floc == FieldLoc::NODE) {
+        mv.coord3d = (*m_non_uniform_coord_nd)(lev).const_arrays();
+    }
+    return mv;
+}
+
+void MeshMap::multiply_detJ(
+    int lev, const amrex::MultiFab& src, amrex::MultiFab& dst, int ngrow) const
+{
+    const auto mv = view(lev, FieldLoc::CELL);
+    const auto& src_arrs = src.const_arrays();
+    const auto& dst_arrs = dst.arrays();
+    amrex::ParallelFor(
+        dst, amrex::IntVect(ngrow),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            dst_arrs[nbx](i, j, k) =
+                src_arrs[nbx](i, j, k) * mv.detJ(nbx, i, j, k);
+        });
+    amrex::Gpu::synchronize();
+}
+
 } // namespace amr_wind
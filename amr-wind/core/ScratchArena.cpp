@@ -0,0 +1,155 @@
+#include "amr-wind/core/ScratchArena.H"
+
+#include "AMReX_Arena.H"
+#include "AMReX_Gpu.H"
+#include "AMReX_OpenMP.H"
+
+namespace amr_wind {
+
+namespace {
+
+//! Chunk sizes are rounded up to this many values to keep the FABs aligned
+constexpr amrex::Long scratch_align = 16;
+
+} // namespace
+
+ScratchArena::Frame::Frame(ScratchArena& arena, Slab& slab)
+    : m_arena(arena), m_slab(&slab)
+{
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+        !slab.active, "ScratchArena: only one frame per thread/stream");
+    slab.active = true;
+}
+
+ScratchArena::Frame::Frame(Frame&& other) noexcept
+    : m_arena(other.m_arena), m_slab(other.m_slab)
+{
+    other.m_slab = nullptr;
+}
+
+ScratchArena::Frame::~Frame()
+{
+    if (m_slab != nullptr) {
+        m_arena.close(*m_slab);
+    }
+}
+
+amrex::FArrayBox ScratchArena::Frame::fab(const amrex::Box& bx, int ncomp)
+{
+    AMREX_ASSERT(m_slab != nullptr);
+    const amrex::Long nelems = bx.numPts() * ncomp;
+    return amrex::FArrayBox(bx, ncomp, m_arena.allocate(*m_slab, nelems));
+}
+
+ScratchArena::ScratchArena()
+{
+#ifdef AMREX_USE_GPU
+    // Additional slab for work launched on the default stream
+    m_slabs.resize(amrex::Gpu::numGpuStreams() + 1);
+#else
+    m_slabs.resize(amrex::OpenMP::get_max_threads());
+#endif
+}
+
+ScratchArena::~ScratchArena() { release(); }
+
+ScratchArena::Frame ScratchArena::frame()
+{
+    const int idx = slab_index();
+    AMREX_ASSERT((idx >= 0) && (idx < static_cast<int>(m_slabs.size())));
+    return Frame(*this, m_slabs[idx]);
+}
+
+void ScratchArena::release()
+{
+    amrex::Gpu::streamSynchronizeAll();
+    for (auto& slab : m_slabs) {
+        AMREX_ALWAYS_ASSERT(!slab.active);
+        free_chunks(slab);
+    }
+}
+
+amrex::Long ScratchArena::nbytes() const
+{
+    amrex::Long total = 0;
+    for (const auto& slab : m_slabs) {
+        for (const auto& chunk : slab.chunks) {
+            total += chunk.size * static_cast<amrex::Long>(sizeof(amrex::Real));
+        }
+    }
+    return total;
+}
+
+amrex::Real* ScratchArena::allocate(Slab& slab, amrex::Long nelems)
+{
+    nelems = ((nelems + scratch_align - 1) / scratch_align) * scratch_align;
+
+    // Use the first chunk (from the current one) with enough space left
+    const int nchunks = slab.chunks.size();
+    for (; slab.chunk < nchunks; ++slab.chunk, slab.offset = 0) {
+        auto& chunk = slab.chunks[slab.chunk];
+        if (slab.offset + nelems <= chunk.size) {
+            amrex::Real* ptr = chunk.data + slab.offset;
+            slab.offset += nelems;
+            return ptr;
+        }
+    }
+
+    // Grow the slab, the chunks are merged when the frame is closed
+    Chunk chunk;
+    chunk.size = nelems;
+    chunk.data = static_cast<amrex::Real*>(
+        amrex::The_Arena()->alloc(nelems * sizeof(amrex::Real)));
+    slab.chunks.push_back(chunk);
+    slab.chunk = nchunks;
+    slab.offset = nelems;
+    return chunk.data;
+}
+
+void ScratchArena::close(Slab& slab)
+{
+    // Merge the chunks so that the next frame is served from a single chunk.
+    // This only happens while the slab is still growing.
+    if (slab.chunks.size() > 1) {
+        amrex::Long total = 0;
+        for (const auto& chunk : slab.chunks) {
+            total += chunk.size;
+        }
+
+        // Kernels on this stream might still be using the memory
+        amrex::Gpu::streamSynchronize();
+        free_chunks(slab);
+
+        Chunk chunk;
+        chunk.size = total;
+        chunk.data = static_cast<amrex::Real*>(
+            amrex::The_Arena()->alloc(total * sizeof(amrex::Real)));
+        slab.chunks.push_back(chunk);
+    }
+
+    slab.chunk = 0;
+    slab.offset = 0;
+    slab.active = false;
+}
+
+void ScratchArena::free_chunks(Slab& slab)
+{
+    for (auto& chunk : slab.chunks) {
+        amrex::The_Arena()->free(chunk.data);
+    }
+    slab.chunks.clear();
+    slab.chunk = 0;
+    slab.offset = 0;
+}
+
+int ScratchArena::slab_index()
+{
+#ifdef AMREX_USE_GPU
+    // The default stream has an index of -1
+    return amrex::Gpu::Device::streamIndex() + 1;
+#else
+    return amrex::OpenMP::get_thread_num();
+#endif
+}
+
+} // namespace amr_wind
@@ -0,0 +1,179 @@
+#include "amr-wind/core/ScratchFieldPool.H"
+
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind {
+
+ScratchFieldPool::ScratchFieldPool(int max_levels)
+    : m_generation(max_levels, 0)
+{}
+
+amrex::Long ScratchFieldPool::num_bytes(const amrex::MultiFab& mfab)
+{
+    amrex::Long nbytes = 0;
+    for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+        nbytes += static_cast<amrex::Long>(mfab[mfi].nBytes());
+    }
+    return nbytes;
+}
+
+void ScratchFieldPool::update_peak()
+{
+    m_stats.peak_bytes = amrex::max(
+        m_stats.peak_bytes, m_stats.bytes_in_use + m_stats.bytes_pooled);
+}
+
+amrex::MultiFab ScratchFieldPool::acquire(
+    int lev,
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm,
+    int ncomp,
+    int nghost,
+    FieldLoc floc,
+    const amrex::FabFactory<amrex::FArrayBox>& factory)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_enabled) {
+        auto found = m_free.find(std::make_tuple(lev, ncomp, nghost, floc));
+        if ((found != m_free.end()) && !found->second.empty()) {
+            auto& entry = found->second.back();
+            amrex::MultiFab mfab(std::move(entry.mfab));
+            const auto nbytes = entry.nbytes;
+            found->second.pop_back();
+
+            m_stats.bytes_pooled -= nbytes;
+            m_stats.bytes_in_use += nbytes;
+            ++m_stats.hits;
+            return mfab;
+        }
+    }
+
+    amrex::MultiFab mfab(ba, dm, ncomp, nghost, amrex::MFInfo(), factory);
+    m_stats.bytes_in_use += num_bytes(mfab);
+    ++m_stats.misses;
+    update_peak();
+    return mfab;
+}
+
+void ScratchFieldPool::release(
+    const amrex::Vector<int>& generation,
+    int ncomp,
+    int nghost,
+    FieldLoc floc,
+    amrex::Vector<amrex::MultiFab>& data)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (int lev = 0; lev < static_cast<int>(data.size()); ++lev) {
+        auto& mfab = data[lev];
+        if (!mfab.ok()) {
+            continue;
+        }
+
+        const auto nbytes = num_bytes(mfab);
+        m_stats.bytes_in_use -= nbytes;
+
+        // Data leased before a regrid does not match the current grids and
+        // is released back to the arena instead
+        const bool is_current = (lev < static_cast<int>(generation.size())) &&
+                                (lev < static_cast<int>(m_generation.size())) &&
+                                (generation[lev] == m_generation[lev]);
+        const bool fits =
+            (m_max_pooled_bytes < 0) || (nbytes <= m_max_pooled_bytes);
+
+        if (m_enabled && is_current && fits) {
+            PooledFab entry;
+            entry.mfab = std::move(mfab);
+            entry.nbytes = nbytes;
+            entry.last_use = ++m_release_count;
+            m_free[std::make_tuple(lev, ncomp, nghost, floc)].push_back(
+                std::move(entry));
+            m_stats.bytes_pooled += nbytes;
+        } else {
+            mfab.clear();
+        }
+    }
+    data.clear();
+
+    evict();
+}
+
+void ScratchFieldPool::set_max_pooled_bytes(amrex::Long nbytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_max_pooled_bytes = nbytes;
+    evict();
+}
+
+void ScratchFieldPool::evict()
+{
+    if (m_max_pooled_bytes < 0) {
+        return;
+    }
+
+    while (m_stats.bytes_pooled > m_max_pooled_bytes) {
+        // The pool holds a handful of layouts, so a linear search is cheap
+        auto oldest = m_free.end();
+        int oldest_idx = -1;
+        amrex::Long oldest_use = m_release_count + 1;
+        for (auto it = m_free.begin(); it != m_free.end(); ++it) {
+            for (int i = 0; i < static_cast<int>(it->second.size()); ++i) {
+                if (it->second[i].last_use < oldest_use) {
+                    oldest = it;
+                    oldest_idx = i;
+                    oldest_use = it->second[i].last_use;
+                }
+            }
+        }
+        if (oldest == m_free.end()) {
+            break;
+        }
+
+        auto& fabs = oldest->second;
+        m_stats.bytes_pooled -= fabs[oldest_idx].nbytes;
+        ++m_stats.evictions;
+        fabs.erase(fabs.begin() + oldest_idx);
+        if (fabs.empty()) {
+            m_free.erase(oldest);
+        }
+    }
+}
+
+void ScratchFieldPool::invalidate_level(int lev)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    ++m_generation[lev];
+    for (auto it = m_free.begin(); it != m_free.end();) {
+        if (std::get<0>(it->first) == lev) {
+            for (const auto& entry : it->second) {
+                m_stats.bytes_pooled -= entry.nbytes;
+            }
+            it = m_free.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ScratchFieldPool::print_stats() const
+{
+    amrex::Long hits = m_stats.hits;
+    amrex::Long misses = m_stats.misses;
+    amrex::Long evictions = m_stats.evictions;
+    amrex::Long peak = m_stats.peak_bytes;
+    amrex::ParallelDescriptor::ReduceLongSum(hits);
+    amrex::ParallelDescriptor::ReduceLongSum(misses);
+    amrex::ParallelDescriptor::ReduceLongSum(evictions);
+    amrex::ParallelDescriptor::ReduceLongMax(peak);
+
+    amrex::Print() << "Scratch field pool: hits = " << hits
+                   << " misses = " << misses << " evictions = " << evictions
+                   << " max peak memory per rank (MB) = "
+                   << static_cast<double>(peak) / (1024.0 * 1024.0)
+                   << std::endl;
+}
+
+} // namespace amr_wind
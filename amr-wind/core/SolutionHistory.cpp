@@ -0,0 +1,93 @@
+#include <cmath>
+
+#include "amr-wind/core/SolutionHistory.H"
+
+#include "AMReX_ParmParse.H"
+
+namespace amr_wind {
+
+SolutionHistory::SolutionHistory(const std::string& prefix)
+{
+    amrex::ParmParse pp(prefix);
+    pp.query("initial_guess_order", m_order);
+    m_order = amrex::min(m_order, max_order);
+}
+
+void SolutionHistory::push(
+    const amrex::Vector<const amrex::MultiFab*>& phi, const amrex::Real time)
+{
+    if (!enabled()) {
+        return;
+    }
+
+    const int nlevels = phi.size();
+    Entry entry;
+    if (!m_history.empty() &&
+        std::abs(m_history.front().time - time) <=
+            1.0e-12 * amrex::max(std::abs(time), 1.0)) {
+        entry = std::move(m_history.front());
+        m_history.pop_front();
+    } else if (size() > m_order) {
+        // Recycle the memory of the oldest solution
+        entry = std::move(m_history.back());
+        m_history.pop_back();
+    }
+
+    entry.time = time;
+    entry.phi.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        auto& mf = entry.phi[lev];
+        if (!mf.ok() || (mf.boxArray() != phi[lev]->boxArray()) ||
+            (mf.DistributionMap() != phi[lev]->DistributionMap())) {
+            mf.define(phi[lev]->boxArray(), phi[lev]->DistributionMap(), 1, 0);
+        }
+        amrex::MultiFab::Copy(mf, *phi[lev], 0, 0, 1, 0);
+    }
+    m_history.push_front(std::move(entry));
+}
+
+bool SolutionHistory::initial_guess(
+    const amrex::Vector<amrex::MultiFab*>& phi,
+    const amrex::Real time,
+    const amrex::Real scale) const
+{
+    if (!enabled() || m_history.empty()) {
+        return false;
+    }
+
+    const int nlevels = phi.size();
+    const int npts = amrex::min(m_order + 1, size());
+    for (int i = 0; i < npts; ++i) {
+        const auto& hphi = m_history[i].phi;
+        if (static_cast<int>(hphi.size()) != nlevels) {
+            return false;
+        }
+        for (int lev = 0; lev < nlevels; ++lev) {
+            if (hphi[lev].boxArray() != phi[lev]->boxArray()) {
+                return false;
+            }
+        }
+    }
+
+    // Lagrange interpolation weights evaluated at the new time
+    amrex::Vector<amrex::Real> wts(npts, scale);
+    for (int i = 0; i < npts; ++i) {
+        for (int j = 0; j < npts; ++j) {
+            if (j != i) {
+                wts[i] *= (time - m_history[j].time) /
+                          (m_history[i].time - m_history[j].time);
+            }
+        }
+    }
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        phi[lev]->setVal(0.0);
+        for (int i = 0; i < npts; ++i) {
+            amrex::MultiFab::Saxpy(
+                *phi[lev], wts[i], m_history[i].phi[lev], 0, 0, 1, 0);
+        }
+    }
+    return true;
+}
+
+} // namespace amr_wind
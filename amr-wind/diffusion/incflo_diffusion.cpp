@@ -203,60 +203,25 @@ void viscosity_to_uniform_space(
     const amr_wind::FieldRepo& repo,
     int lev)
 {
-    const auto& mesh_fac_xf =
-        repo.get_mesh_mapping_field(amr_wind::FieldLoc::XFACE);
-    const auto& mesh_fac_yf =
-        repo.get_mesh_mapping_field(amr_wind::FieldLoc::YFACE);
-    const auto& mesh_fac_zf =
-        repo.get_mesh_mapping_field(amr_wind::FieldLoc::ZFACE);
-    const auto& mesh_detJ_xf =
-        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::XFACE);
-    const auto& mesh_detJ_yf =
-        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::YFACE);
-    const auto& mesh_detJ_zf =
-        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::ZFACE);
+    const amrex::Array<amr_wind::FieldLoc, AMREX_SPACEDIM> flocs{
+        {amr_wind::FieldLoc::XFACE, amr_wind::FieldLoc::YFACE,
+         amr_wind::FieldLoc::ZFACE}};
 
-    // beta accounted for mesh mapping (x-face) = J/fac^2 * mu
-    for (amrex::MFIter mfi(b[0]); mfi.isValid(); ++mfi) {
-        amrex::Array4<amrex::Real> const& mu = b[0].array(mfi);
-        amrex::Array4<amrex::Real const> const& fac =
-            mesh_fac_xf(lev).array(mfi);
-        amrex::Array4<amrex::Real const> const& detJ =
-            mesh_detJ_xf(lev).const_array(mfi);
-
-        amrex::ParallelFor(
-            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                mu(i, j, k) =
-                    mu(i, j, k) * detJ(i, j, k) / std::pow(fac(i, j, k, 0), 2);
-            });
-    }
-    // beta accounted for mesh mapping (y-face) = J/fac^2 * mu
-    for (amrex::MFIter mfi(b[1]); mfi.isValid(); ++mfi) {
-        amrex::Array4<amrex::Real> const& mu = b[1].array(mfi);
-        amrex::Array4<amrex::Real const> const& fac =
-            mesh_fac_yf(lev).array(mfi);
-        amrex::Array4<amrex::Real const> const& detJ =
-            mesh_detJ_yf(lev).const_array(mfi);
-
-        amrex::ParallelFor(
-            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                mu(i, j, k) =
-                    mu(i, j, k) * detJ(i, j, k) / std::pow(fac(i, j, k, 1), 2);
-            });
-    }
-    // beta accounted for mesh mapping (z-face) = J/fac^2 * mu
-    for (amrex::MFIter mfi(b[2]); mfi.isValid(); ++mfi) {
-        amrex::Array4<amrex::Real> const& mu = b[2].array(mfi);
-        amrex::Array4<amrex::Real const> const& fac =
-            mesh_fac_zf(lev).array(mfi);
-        amrex::Array4<amrex::Real const> const& detJ =
-            mesh_detJ_zf(lev).const_array(mfi);
-
-        amrex::ParallelFor(
-            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                mu(i, j, k) =
-                    mu(i, j, k) * detJ(i, j, k) / std::pow(fac(i, j, k, 2), 2);
-            });
+    // beta accounted for mesh mapping (on each face) = J/fac^2 * mu
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        const auto mv = repo.mesh_map().view(lev, flocs[dir]);
+        for (amrex::MFIter mfi(b[dir]); mfi.isValid(); ++mfi) {
+            amrex::Array4<amrex::Real> const& mu = b[dir].array(mfi);
+            const int nbx = mfi.LocalIndex();
+
+            amrex::ParallelFor(
+                mfi.tilebox(),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real fac = mv.fac(nbx, i, j, k, dir);
+                    mu(i, j, k) =
+                        mu(i, j, k) * mv.detJ(nbx, i, j, k) / (fac * fac);
+                });
+        }
     }
 }
 
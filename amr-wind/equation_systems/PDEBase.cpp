@@ -77,14 +77,16 @@ void PDEMgr::advance_states()
 void PDEMgr::fillpatch_state_fields(
     const amrex::Real time, const FieldState fstate)
 {
+    amrex::Vector<Field*> fields;
     if (m_constant_density) {
-        m_sim.repo().get_field("density").state(fstate).fillpatch(time);
+        fields.push_back(&m_sim.repo().get_field("density").state(fstate));
     }
 
-    icns().fields().field.state(fstate).fillpatch(time);
+    fields.push_back(&icns().fields().field.state(fstate));
     for (auto& eqn : scalar_eqns()) {
-        eqn->fields().field.state(fstate).fillpatch(time);
+        fields.push_back(&eqn->fields().field.state(fstate));
     }
+    m_sim.repo().fillpatch(fields, time);
 }
 
 } // namespace pde
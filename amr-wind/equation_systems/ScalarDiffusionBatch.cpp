@@ -0,0 +1,221 @@
+#include <algorithm>
+
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
+#include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX_MLMG.H"
+
+namespace amr_wind {
+namespace pde {
+
+ScalarDiffusionBatch::ScalarDiffusionBatch(CFDSim& sim) : m_sim(sim) {}
+
+void ScalarDiffusionBatch::setup(
+    const amrex::Vector<std::unique_ptr<PDEBase>>& eqns)
+{
+    reset();
+    m_batched.clear();
+
+    amrex::Vector<const PDEBase*> group;
+    auto add_group = [&]() {
+        if (group.size() > 1) {
+            m_batched.insert(m_batched.end(), group.begin(), group.end());
+        }
+        group.clear();
+    };
+
+    for (const auto& eqn : eqns) {
+        if (eqn->can_batch_solve()) {
+            group.push_back(eqn.get());
+        } else {
+            add_group();
+        }
+    }
+    add_group();
+}
+
+bool ScalarDiffusionBatch::batched(const PDEBase& eqn) const
+{
+    return std::find(m_batched.begin(), m_batched.end(), &eqn) !=
+           m_batched.end();
+}
+
+bool ScalarDiffusionBatch::add(PDEBase& eqn)
+{
+    if (!batched(eqn)) {
+        return false;
+    }
+
+    auto* op = eqn.prepare_batched_solve();
+    if (op == nullptr) {
+        return false;
+    }
+
+    m_pdes.push_back(&eqn);
+    m_ops.push_back(op);
+    return true;
+}
+
+void ScalarDiffusionBatch::reset()
+{
+    m_solver.reset();
+    m_solver_fields.clear();
+}
+
+void ScalarDiffusionBatch::init_solver(const DiffOpVec& ops)
+{
+    BL_PROFILE("amr-wind::ScalarDiffusionBatch::init_solver");
+    const auto& mesh = m_sim.repo().mesh();
+    const int ncomp = ops.size();
+    amrex::LPInfo isolve = m_options.lpinfo();
+
+    if (!m_sim.has_overset()) {
+        m_solver.reset(new amrex::MLABecLaplacian(
+            mesh.Geom(0, mesh.finestLevel()),
+            mesh.boxArray(0, mesh.finestLevel()),
+            mesh.DistributionMap(0, mesh.finestLevel()), isolve, {}, ncomp));
+    } else {
+        auto imask =
+            m_sim.repo().get_int_field("mask_cell").vec_const_ptrs();
+        m_solver.reset(new amrex::MLABecLaplacian(
+            mesh.Geom(0, mesh.finestLevel()),
+            mesh.boxArray(0, mesh.finestLevel()),
+            mesh.DistributionMap(0, mesh.finestLevel()), imask, isolve, {},
+            ncomp));
+    }
+    m_solver->setMaxOrder(m_options.max_order);
+
+    amrex::Vector<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>> lobc,
+        hibc;
+    m_solver_fields.clear();
+    for (auto* op : ops) {
+        auto& field = op->pde_fields().field;
+        lobc.push_back(
+            diffusion::get_diffuse_scalar_bc(field, amrex::Orientation::low));
+        hibc.push_back(
+            diffusion::get_diffuse_scalar_bc(field, amrex::Orientation::high));
+        m_solver_fields.push_back(field.name());
+    }
+    m_solver->setDomainBC(lobc, hibc);
+}
+
+amrex::Vector<PDEBase*> ScalarDiffusionBatch::solve(const amrex::Real dt)
+{
+    BL_PROFILE("amr-wind::ScalarDiffusionBatch::solve");
+    amrex::Vector<PDEBase*> pdes;
+    DiffOpVec ops;
+    std::swap(pdes, m_pdes);
+    std::swap(ops, m_ops);
+
+    // Nothing to gain from a multi-component solve for a single scalar
+    if (pdes.size() < 2) {
+        for (auto* eqn : pdes) {
+            eqn->solve(dt);
+        }
+        return pdes;
+    }
+
+    // The operator is reused as long as the same scalars are batched
+    bool same_fields =
+        (m_solver != nullptr) && (m_solver_fields.size() == ops.size());
+    for (int n = 0; same_fields && (n < static_cast<int>(ops.size())); ++n) {
+        same_fields = (m_solver_fields[n] == ops[n]->pde_fields().field.name());
+    }
+    if (!same_fields) {
+        init_solver(ops);
+    }
+
+    auto& repo = m_sim.repo();
+    const auto& geom = repo.mesh().Geom();
+    const int nlevels = repo.num_active_levels();
+    const int ncomp = ops.size();
+    const bool mesh_mapping = m_sim.has_mesh_mapping();
+    const auto& density = repo.get_field("density").state(FieldState::New);
+
+    // Combined solution, the ghost cells hold the boundary values
+    auto soln = repo.create_scratch_field(ncomp, 1);
+    auto rhs = repo.create_scratch_field(ncomp, 0);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (int n = 0; n < ncomp; ++n) {
+            const auto& field = ops[n]->pde_fields().field;
+            if (field.in_uniform_space()) {
+                amrex::Abort(
+                    "For diffusion solve, scalars should not be in uniform "
+                    "mesh space.");
+            }
+            amrex::MultiFab::Copy((*soln)(lev), field(lev), 0, n, 1, 1);
+        }
+    }
+
+    m_solver->setScalars(1.0, dt);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        m_solver->setLevelBC(lev, &(*soln)(lev));
+    }
+
+    // All batched operators use the density as the A coefficients
+    ops[0]->set_acoeffs(*m_solver, FieldState::New);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::Array<amrex::MultiFab, AMREX_SPACEDIM> bcoeffs;
+        for (int n = 0; n < ncomp; ++n) {
+            auto b = diffusion::average_velocity_eta_to_faces(
+                geom[lev], ops[n]->pde_fields().mueff(lev));
+            if (mesh_mapping) {
+                diffusion::viscosity_to_uniform_space(b, repo, lev);
+            }
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                if (n == 0) {
+                    bcoeffs[idim].define(
+                        b[idim].boxArray(), b[idim].DistributionMap(), ncomp,
+                        0);
+                }
+                amrex::MultiFab::Copy(bcoeffs[idim], b[idim], 0, n, 1, 0);
+            }
+        }
+        m_solver->setBCoeffs(lev, amrex::GetArrOfConstPtrs(bcoeffs));
+    }
+
+    // Always multiply with rho since there is no diffusion term for density
+    for (int lev = 0; lev < nlevels; ++lev) {
+        auto& rhs_lev = (*rhs)(lev);
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(rhs_lev, amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& rhs_a = rhs_lev.array(mfi);
+            const auto& fld = (*soln)(lev).const_array(mfi);
+            const auto& rho = density(lev).const_array(mfi);
+
+            amrex::ParallelFor(
+                bx, ncomp,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    rhs_a(i, j, k, n) = rho(i, j, k) * fld(i, j, k, n);
+                });
+        }
+    }
+
+    amrex::MLMG mlmg(*m_solver);
+    m_options(mlmg);
+    mlmg.solve(
+        soln->vec_ptrs(), rhs->vec_const_ptrs(), m_options.rel_tol,
+        m_options.abs_tol);
+
+    io::print_mlmg_info("batched_scalar_solve", mlmg);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (int n = 0; n < ncomp; ++n) {
+            auto& field = ops[n]->pde_fields().field;
+            amrex::MultiFab::Copy(field(lev), (*soln)(lev), n, 0, 1, 0);
+        }
+    }
+
+    return pdes;
+}
+
+} // namespace pde
+} // namespace amr_wind
@@ -51,6 +51,10 @@ MacProjOp::MacProjOp(
 {
     amrex::ParmParse pp("incflo");
     pp.query("rho_0", m_rho_0);
+
+    // MacProjOp is recreated on regrid, so the history is never stale
+    m_phi_history.emplace_back("mac_proj");
+    m_phi_history.emplace_back("mac_proj");
 }
 
 void MacProjOp::init_projector(const MacProjOp::FaceFabPtrVec& beta) noexcept
@@ -206,6 +210,27 @@ void MacProjOp::operator()(const FieldState fstate, const amrex::Real dt)
         m_mac_proj->project(
             phif->vec_ptrs(), m_options.rel_tol, m_options.abs_tol);
 
+    } else if (m_phi_history[0].enabled()) {
+        // Start from the solution extrapolated from the previous timesteps
+        const int ihist = (fstate == FieldState::New) ? 1 : 0;
+        auto& history = m_phi_history[ihist];
+        m_proj_time[ihist] += dt;
+        const amrex::Real time = m_proj_time[ihist];
+
+        auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::CELL);
+        if (!history.initial_guess(phif->vec_ptrs(), time, dt)) {
+            for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+                (*phif)(lev).setVal(0.0);
+            }
+        }
+
+        m_mac_proj->project(
+            phif->vec_ptrs(), m_options.rel_tol, m_options.abs_tol);
+
+        for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+            (*phif)(lev).mult(1.0 / dt, 0, 1, 0);
+        }
+        history.push(phif->vec_const_ptrs(), time);
     } else {
         m_mac_proj->project(m_options.rel_tol, m_options.abs_tol);
     }
@@ -222,68 +247,31 @@ void MacProjOp::mac_proj_to_uniform_space(
     amrex::Real ovst_fac,
     int lev) noexcept
 {
-    const auto& mesh_fac_xf =
-        repo.get_mesh_mapping_field(amr_wind::FieldLoc::XFACE);
-    const auto& mesh_fac_yf =
-        repo.get_mesh_mapping_field(amr_wind::FieldLoc::YFACE);
-    const auto& mesh_fac_zf =
-        repo.get_mesh_mapping_field(amr_wind::FieldLoc::ZFACE);
-    const auto& mesh_detJ_xf =
-        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::XFACE);
-    const auto& mesh_detJ_yf =
-        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::YFACE);
-    const auto& mesh_detJ_zf =
-        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::ZFACE);
+    const amrex::Array<amr_wind::FieldLoc, ICNS::ndim> flocs{
+        {amr_wind::FieldLoc::XFACE, amr_wind::FieldLoc::YFACE,
+         amr_wind::FieldLoc::ZFACE}};
+    const amrex::Array<amr_wind::Field*, ICNS::ndim> umac{
+        {&u_mac, &v_mac, &w_mac}};
 
     // scale U^mac to accommodate for mesh mapping -> U^bar = J/fac *
     // U^mac beta accounted for mesh mapping = J/fac^2 * 1/rho construct
-    // rho and mesh map u_mac on x-face
-    for (amrex::MFIter mfi(*(rho_face[0])); mfi.isValid(); ++mfi) {
-        amrex::Array4<amrex::Real> const& u = u_mac(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& rho = rho_face[0]->array(mfi);
-        amrex::Array4<amrex::Real const> const& fac =
-            mesh_fac_xf(lev).array(mfi);
-        amrex::Array4<amrex::Real const> const& detJ =
-            mesh_detJ_xf(lev).const_array(mfi);
-
-        amrex::ParallelFor(
-            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                u(i, j, k) *= detJ(i, j, k) / fac(i, j, k, 0);
-                rho(i, j, k) = ovst_fac * detJ(i, j, k) /
-                               std::pow(fac(i, j, k, 0), 2) / rho(i, j, k);
-            });
-    }
-    // construct rho on y-face
-    for (amrex::MFIter mfi(*(rho_face[1])); mfi.isValid(); ++mfi) {
-        amrex::Array4<amrex::Real> const& v = v_mac(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& rho = rho_face[1]->array(mfi);
-        amrex::Array4<amrex::Real const> const& fac =
-            mesh_fac_yf(lev).array(mfi);
-        amrex::Array4<amrex::Real const> const& detJ =
-            mesh_detJ_yf(lev).const_array(mfi);
-
-        amrex::ParallelFor(
-            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                v(i, j, k) *= detJ(i, j, k) / fac(i, j, k, 1);
-                rho(i, j, k) = ovst_fac * detJ(i, j, k) /
-                               std::pow(fac(i, j, k, 1), 2) / rho(i, j, k);
-            });
-    }
-    // construct rho on z-face
-    for (amrex::MFIter mfi(*(rho_face[2])); mfi.isValid(); ++mfi) {
-        amrex::Array4<amrex::Real> const& w = w_mac(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& rho = rho_face[2]->array(mfi);
-        amrex::Array4<amrex::Real const> const& fac =
-            mesh_fac_zf(lev).array(mfi);
-        amrex::Array4<amrex::Real const> const& detJ =
-            mesh_detJ_zf(lev).const_array(mfi);
-
-        amrex::ParallelFor(
-            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                w(i, j, k) *= detJ(i, j, k) / fac(i, j, k, 2);
-                rho(i, j, k) = ovst_fac * detJ(i, j, k) /
-                               std::pow(fac(i, j, k, 2), 2) / rho(i, j, k);
-            });
+    // rho and mesh map the face velocity on each face
+    for (int dir = 0; dir < ICNS::ndim; ++dir) {
+        const auto mv = repo.mesh_map().view(lev, flocs[dir]);
+        for (amrex::MFIter mfi(*(rho_face[dir])); mfi.isValid(); ++mfi) {
+            amrex::Array4<amrex::Real> const& u = (*umac[dir])(lev).array(mfi);
+            amrex::Array4<amrex::Real> const& rho = rho_face[dir]->array(mfi);
+            const int nbx = mfi.LocalIndex();
+
+            amrex::ParallelFor(
+                mfi.tilebox(),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real fac = mv.fac(nbx, i, j, k, dir);
+                    const amrex::Real detJ = mv.detJ(nbx, i, j, k);
+                    u(i, j, k) *= detJ / fac;
+                    rho(i, j, k) = ovst_fac * detJ / (fac * fac) / rho(i, j, k);
+                });
+        }
     }
 }
 
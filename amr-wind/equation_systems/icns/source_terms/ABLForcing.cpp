@@ -47,6 +47,16 @@ void ABLForcing::operator()(
     });
 }
 
+void ABLForcing::add_fused_form(
+    const int /*lev*/,
+    const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/,
+    FusedSource& form) const
+{
+    form.constant[0] += m_abl_forcing[0];
+    form.constant[1] += m_abl_forcing[1];
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
@@ -34,6 +34,18 @@ void ActuatorForcing::operator()(
     });
 }
 
+void ActuatorForcing::add_fused_form(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const FieldState /*fstate*/,
+    FusedSource& form) const
+{
+    const int idx = form.add_input(m_act_src(lev).const_array(mfi));
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        form.coeff(idx, i, i) = 1.0;
+    }
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
@@ -47,6 +47,20 @@ void BodyForce::operator()(
     });
 }
 
+void BodyForce::add_fused_form(
+    const int /*lev*/,
+    const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/,
+    FusedSource& form) const
+{
+    const auto& time = m_time.current_time();
+    amrex::Real coeff =
+        (m_type == "oscillatory") ? std::cos(m_omega * time) : 1.0;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        form.constant[i] += coeff * m_body_force[i];
+    }
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
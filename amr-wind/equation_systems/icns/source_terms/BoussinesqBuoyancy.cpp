@@ -61,6 +61,22 @@ void BoussinesqBuoyancy::operator()(
     });
 }
 
+void BoussinesqBuoyancy::add_fused_form(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const FieldState fstate,
+    FusedSource& form) const
+{
+    // g * beta * (T0 - T) = -g * beta * (T - T0)
+    const int idx = form.add_input(
+        m_temperature.state(field_impl::phi_state(fstate))(lev).const_array(
+            mfi));
+    form.offset(idx, 0) = m_ref_theta;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        form.coeff(idx, i, 0) = -m_gravity[i] * m_beta;
+    }
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
@@ -97,6 +97,30 @@ void CoriolisForcing::operator()(
     });
 }
 
+void CoriolisForcing::add_fused_form(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const FieldState fstate,
+    FusedSource& form) const
+{
+    const int idx = form.add_input(
+        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi));
+
+    // The forcing is a linear function of the velocity: the accelerations in
+    // the (east, north, up) frame are computed from the velocity components in
+    // that frame and projected back onto the Cartesian directions
+    const auto corfac = m_coriolis_factor;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            form.coeff(idx, i, j) =
+                corfac *
+                (m_east[i] * (m_sinphi * m_north[j] - m_cosphi * m_up[j]) -
+                 m_north[i] * m_sinphi * m_east[j] +
+                 m_up[i] * m_cosphi * m_east[j]);
+        }
+    }
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
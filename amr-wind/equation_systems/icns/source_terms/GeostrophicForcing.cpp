@@ -70,6 +70,16 @@ void GeostrophicForcing::operator()(
     });
 }
 
+void GeostrophicForcing::add_fused_form(
+    const int /*lev*/,
+    const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/,
+    FusedSource& form) const
+{
+    form.constant[0] += m_g_forcing[0];
+    form.constant[1] += m_g_forcing[1];
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
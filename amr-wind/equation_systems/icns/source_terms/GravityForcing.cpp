@@ -47,6 +47,17 @@ void GravityForcing::operator()(
     });
 }
 
+void GravityForcing::add_fused_form(
+    const int /*lev*/,
+    const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/,
+    FusedSource& form) const
+{
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        form.constant[i] += m_gravity[i];
+    }
+}
+
 } // namespace icns
 } // namespace pde
 } // namespace amr_wind
@@ -3,11 +3,13 @@
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/utilities/tagging/RefinementCriteria.H"
 #include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/overset/OversetManager.H"
+#include "amr-wind/core/LoadBalancer.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -109,6 +111,9 @@ void incflo::init_amr_wind_modules()
     for (auto& eqn : scalar_eqns()) {
         eqn->initialize();
     }
+    if (m_scalar_diff_batch) {
+        m_scalar_diff_batch->setup(scalar_eqns());
+    }
 
     m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
     m_sim.post_manager().post_init_actions();
@@ -164,12 +169,13 @@ void incflo::InitData()
 
 /** Perform regrid actions at a given timestep.
  *
- *  \return Flag indicating if regrid was performed
+ *  \return Flag indicating if the mesh was regridded or redistributed
  */
 bool incflo::regrid_and_update()
 {
     BL_PROFILE("amr-wind::incflo::regrid_and_update");
 
+    bool remeshed = false;
     if (m_time.do_regrid()) {
         amrex::Print() << "Regrid mesh ... ";
         amrex::Real rstart = amrex::ParallelDescriptor::second();
@@ -180,7 +186,15 @@ bool incflo::regrid_and_update()
             amrex::Print() << "Grid summary: " << std::endl;
             printGridSummary(amrex::OutStream(), 0, finest_level);
         }
+        remeshed = true;
+    }
+
+    // Redistribute the boxes if the measured work is unevenly distributed
+    if (m_sim.load_balancer().check_imbalance(m_time.time_index())) {
+        remeshed = rebalance() || remeshed;
+    }
 
+    if (remeshed) {
         // update mesh map
         {
             if (m_sim.has_mesh_mapping()) {
@@ -206,10 +220,14 @@ bool incflo::regrid_and_update()
 
         m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
 
+        reset_nodal_projector();
         icns().post_regrid_actions();
         for (auto& eqn : scalar_eqns()) {
             eqn->post_regrid_actions();
         }
+        if (m_scalar_diff_batch) {
+            m_scalar_diff_batch->setup(scalar_eqns());
+        }
         for (auto& pp : m_sim.physics()) {
             pp->post_regrid_actions();
         }
@@ -224,7 +242,34 @@ bool incflo::regrid_and_update()
         }
     }
 
-    return m_time.do_regrid();
+    return remeshed;
+}
+
+/** Redistribute the boxes on all levels based on the measured work
+ *
+ *  The levels retain their BoxArrays and are remade with a cost-based
+ *  DistributionMapping when the load balancing efficiency drops below the
+ *  user-defined threshold.
+ *
+ *  \return Flag indicating if any level was redistributed
+ */
+bool incflo::rebalance()
+{
+    BL_PROFILE("amr-wind::incflo::rebalance");
+
+    auto& lb = m_sim.load_balancer();
+    bool rebalanced = false;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        DistributionMapping new_dm;
+        if (lb.rebalance_level(lev, new_dm)) {
+            const BoxArray ba = boxArray(lev);
+            m_repo.remake_level(lev, m_time.current_time(), ba, new_dm);
+            SetDistributionMap(lev, new_dm);
+            lb.reset_level(lev, ba, new_dm);
+            rebalanced = true;
+        }
+    }
+    return rebalanced;
 }
 
 /** Perform actions after a timestep
@@ -242,6 +287,7 @@ void incflo::post_advance_work()
     }
 
     m_sim.post_manager().post_advance_work();
+    m_sim.load_balancer().end_timestep();
     if (m_verbose > 1) {
         PrintMaxValues("end of timestep");
     }
@@ -296,6 +342,10 @@ void incflo::Evolve()
                       "========================\n"
                    << std::endl;
 
+    if (m_verbose > 0) {
+        m_repo.scratch_pool().print_stats();
+    }
+
     // Output at final time
     if (m_time.write_last_plot_file()) {
         m_sim.io_manager().write_plot_file();
@@ -326,6 +376,7 @@ void incflo::MakeNewLevelFromScratch(
 
     SetBoxArray(lev, new_grids);
     SetDistributionMap(lev, new_dmap);
+    m_sim.load_balancer().reset_level(lev, new_grids, new_dmap);
 
     m_repo.make_new_level_from_scratch(lev, time, new_grids, new_dmap);
 
@@ -4,6 +4,7 @@
 #include "amr-wind/core/Physics.H"
 #include "amr-wind/core/field_ops.H"
 #include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/utilities/PostProcessing.H"
@@ -254,11 +255,11 @@ void incflo::ApplyPredictor(bool incremental_projection)
     if (m_use_godunov) {
         const int nghost_force = 1;
         IntVect ng(nghost_force);
-        icns().fields().src_term.fillpatch(m_time.current_time(), ng);
-
+        amrex::Vector<amr_wind::Field*> src_terms{&icns().fields().src_term};
         for (auto& eqn : scalar_eqns()) {
-            eqn->fields().src_term.fillpatch(m_time.current_time(), ng);
+            src_terms.push_back(&eqn->fields().src_term);
         }
+        repo().fillpatch(src_terms, m_time.current_time(), ng);
     }
 
     // Extrapolate and apply MAC projection for advection velocities
@@ -290,6 +291,14 @@ void incflo::ApplyPredictor(bool incremental_projection)
     // updated density at `n+1/2` to be computed before other scalars use it
     // when computing their source terms.
     for (auto& eqn : scalar_eqns()) {
+        // Complete the deferred solves before the next scalar that is not
+        // batched with them
+        const bool batched =
+            m_scalar_diff_batch && m_scalar_diff_batch->batched(*eqn);
+        if (!batched) {
+            solve_batched_scalars();
+        }
+
         // Compute (recompute for Godunov) the scalar forcing terms
         eqn->compute_source_term(amr_wind::FieldState::NPH);
 
@@ -302,6 +311,11 @@ void incflo::ApplyPredictor(bool incremental_projection)
                                       ? m_time.deltaT()
                                       : 0.5 * m_time.deltaT();
 
+            // Defer the solve if it is combined with other scalars
+            if (batched && m_scalar_diff_batch->add(*eqn)) {
+                continue;
+            }
+
             // Solve diffusion eqn. and update of the scalar field
             eqn->solve(dt_diff);
 
@@ -315,6 +329,7 @@ void incflo::ApplyPredictor(bool incremental_projection)
             field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
             field.num_comp(), 1);
     }
+    solve_batched_scalars();
 
     // With scalars computed, compute advection of momentum
     icns().compute_advection_term(amr_wind::FieldState::Old);
@@ -505,6 +520,14 @@ void incflo::ApplyCorrector()
     // updated density at `n+1/2` to be computed before other scalars use it
     // when computing their source terms.
     for (auto& eqn : scalar_eqns()) {
+        // Complete the deferred solves before the next scalar that is not
+        // batched with them
+        const bool batched =
+            m_scalar_diff_batch && m_scalar_diff_batch->batched(*eqn);
+        if (!batched) {
+            solve_batched_scalars();
+        }
+
         // Compute (recompute for Godunov) the scalar forcing terms
         // Note this is (rho * scalar) and not just scalar
         eqn->compute_source_term(amr_wind::FieldState::New);
@@ -520,6 +543,11 @@ void incflo::ApplyCorrector()
                                       ? m_time.deltaT()
                                       : 0.5 * m_time.deltaT();
 
+            // Defer the solve if it is combined with other scalars
+            if (batched && m_scalar_diff_batch->add(*eqn)) {
+                continue;
+            }
+
             // Solve diffusion eqn. and update of the scalar field
             eqn->solve(dt_diff);
         }
@@ -531,6 +559,7 @@ void incflo::ApplyCorrector()
             field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
             field.num_comp(), 1);
     }
+    solve_batched_scalars();
 
     // *************************************************************************************
     // Define the forcing terms to use in the final update (using half-time
@@ -566,3 +595,35 @@ void incflo::ApplyCorrector()
     ApplyProjection(
         (density_nph).vec_const_ptrs(), new_time, m_time.deltaT(), incremental);
 }
+
+/** Solve the diffusion systems of the scalars deferred to a batched solve
+ *
+ *  When `incflo.batch_scalar_diffusion` is enabled, the implicit diffusion
+ *  solves of consecutive compatible scalars are skipped within the scalar
+ *  loop of the predictor and corrector and are instead performed here as a
+ *  single multi-component linear solve, before the next scalar that is not
+ *  part of the batch (or at the end of the loop). The post-solve actions and
+ *  the update of the `n+1/2` state of these scalars are also performed here.
+ */
+void incflo::solve_batched_scalars()
+{
+    if (!m_scalar_diff_batch) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::incflo::solve_batched_scalars");
+    amrex::Real dt_diff = (m_diff_type == DiffusionType::Implicit)
+                              ? m_time.deltaT()
+                              : 0.5 * m_time.deltaT();
+
+    for (auto* eqn : m_scalar_diff_batch->solve(dt_diff)) {
+        eqn->post_solve_actions();
+
+        // Update scalar at n+1/2
+        auto& field = eqn->fields().field;
+        amr_wind::field_ops::lincomb(
+            field.state(amr_wind::FieldState::NPH), 0.5,
+            field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
+            field.num_comp(), 1);
+    }
+}
@@ -41,10 +41,8 @@ void incflo::ComputeDt(bool explicit_diffusion)
     const bool mesh_mapping = m_sim.has_mesh_mapping();
 
     const auto& den = density();
-    amr_wind::Field const* mesh_fac =
-        mesh_mapping
-            ? &(m_repo.get_mesh_mapping_field(amr_wind::FieldLoc::CELL))
-            : nullptr;
+
+    const bool use_force_cfl = m_time.use_force_cfl();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         auto const dxinv = geom[lev].InvCellSizeArray();
@@ -54,99 +52,77 @@ void incflo::ComputeDt(bool explicit_diffusion)
         MultiFab const& rho = den(lev);
 
         auto const& vel_arr = vel.const_arrays();
-        MultiArray4<Real const> fac_arr =
-            mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
-                         : MultiArray4<Real const>();
-
-        Real conv_lev = 0.0;
-        Real diff_lev = 0.0;
-        Real force_lev = 0.0;
-
-        conv_lev += amrex::ParReduce(
-            TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-            [=] AMREX_GPU_HOST_DEVICE(
-                int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                auto const& v_bx = vel_arr[box_no];
-
+        const auto mv =
+            mesh_mapping
+                ? m_sim.mesh_mapping()->view(lev, amr_wind::FieldLoc::CELL)
+                : amr_wind::MeshMapView();
+        MultiArray4<Real const> mu_arr =
+            explicit_diffusion ? mu.const_arrays() : MultiArray4<Real const>();
+        MultiArray4<Real const> rho_arr =
+            explicit_diffusion ? rho.const_arrays()
+                               : MultiArray4<Real const>();
+        MultiArray4<Real const> vf_arr =
+            use_force_cfl ? vel_force.const_arrays()
+                          : MultiArray4<Real const>();
+
+        // Compute the convective, diffusive, and forcing contributions in a
+        // single pass over the level
+        auto const cfl_lev = amrex::ParReduce(
+            TypeList<ReduceOpMax, ReduceOpMax, ReduceOpMax>{},
+            TypeList<Real, Real, Real>{}, vel, IntVect(0),
+            [=] AMREX_GPU_HOST_DEVICE(int box_no, int i, int j, int k)
+                -> GpuTuple<Real, Real, Real> {
                 amrex::Real fac_x =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 0) : 1.0;
                 amrex::Real fac_y =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 1) : 1.0;
                 amrex::Real fac_z =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 2) : 1.0;
 
-                return amrex::max(
-                    amrex::Math::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x,
-                    amrex::Math::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                    amrex::Math::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                    -1.0);
-            });
+                const Real dxi = dxinv[0] / fac_x;
+                const Real dyi = dxinv[1] / fac_y;
+                const Real dzi = dxinv[2] / fac_z;
 
-        if (explicit_diffusion) {
-            auto const& mu_arr = mu.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            diff_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, rho, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& mu_bx = mu_arr[box_no];
-                    auto const& rho_bx = rho_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
+                auto const& v_bx = vel_arr[box_no];
+                const Real conv = amrex::max(
+                    amrex::Math::abs(v_bx(i, j, k, 0)) * dxi,
+                    amrex::Math::abs(v_bx(i, j, k, 1)) * dyi,
+                    amrex::Math::abs(v_bx(i, j, k, 2)) * dzi, -1.0);
 
+                Real diff = -1.0;
+                if (explicit_diffusion) {
                     const Real dxinv2 =
-                        2.0 * (dxinv[0] / fac_x * dxinv[0] / fac_x +
-                               dxinv[1] / fac_y * dxinv[1] / fac_y +
-                               dxinv[2] / fac_z * dxinv[2] / fac_z);
-
-                    return amrex::max(
-                        mu_bx(i, j, k) * dxinv2 / rho_bx(i, j, k), -1.0);
-                });
-        }
-
-        if (m_time.use_force_cfl()) {
-            auto const& vf_arr = vel_force.const_arrays();
-            force_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel_force,
-                IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
+                        2.0 * (dxi * dxi + dyi * dyi + dzi * dzi);
+                    diff = amrex::max(
+                        mu_arr[box_no](i, j, k) * dxinv2 /
+                            rho_arr[box_no](i, j, k),
+                        -1.0);
+                }
+
+                Real force = -1.0;
+                if (use_force_cfl) {
                     auto const& vf_bx = vf_arr[box_no];
+                    force = amrex::max(
+                        amrex::Math::abs(vf_bx(i, j, k, 0)) * dxi,
+                        amrex::Math::abs(vf_bx(i, j, k, 1)) * dyi,
+                        amrex::Math::abs(vf_bx(i, j, k, 2)) * dzi, -1.0);
+                }
 
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                    return amrex::max(
-                        amrex::Math::abs(vf_bx(i, j, k, 0)) * dxinv[0] / fac_x,
-                        amrex::Math::abs(vf_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                        amrex::Math::abs(vf_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                        -1.0);
-                });
-        }
+                return {conv, diff, force};
+            });
 
-        conv_cfl = amrex::max(conv_cfl, conv_lev);
-        diff_cfl = amrex::max(diff_cfl, diff_lev);
-        force_cfl = amrex::max(force_cfl, force_lev);
+        conv_cfl = amrex::max(conv_cfl, amrex::get<0>(cfl_lev));
+        diff_cfl = amrex::max(diff_cfl, amrex::get<1>(cfl_lev));
+        force_cfl = amrex::max(force_cfl, amrex::get<2>(cfl_lev));
     }
 
-    ParallelAllReduce::Max<Real>(conv_cfl, ParallelContext::CommunicatorSub());
-    if (explicit_diffusion) {
-        ParallelAllReduce::Max<Real>(
-            diff_cfl, ParallelContext::CommunicatorSub());
-    }
-    if (m_time.use_force_cfl()) {
-        ParallelAllReduce::Max<Real>(
-            force_cfl, ParallelContext::CommunicatorSub());
-    }
+    // Single global reduction for all the contributions
+    Real cfl_max[3] = {conv_cfl, diff_cfl, force_cfl};
+    ParallelAllReduce::Max<Real>(
+        cfl_max, 3, ParallelContext::CommunicatorSub());
+    conv_cfl = cfl_max[0];
+    diff_cfl = cfl_max[1];
+    force_cfl = cfl_max[2];
 
     m_time.set_current_cfl(conv_cfl, diff_cfl, force_cfl);
 }
@@ -1,4 +1,5 @@
 #include "amr-wind/incflo.H"
+#include "amr-wind/core/LoadBalancer.H"
 
 using namespace amrex;
 
@@ -15,7 +16,11 @@ void incflo::MakeNewLevelFromCoarse(
                        << std::endl;
     }
 
-    m_repo.make_new_level_from_coarse(lev, time, ba, dm);
+    auto& lb = m_sim.load_balancer();
+    const auto new_dm = lb.distribution_map(lev, ba, dm);
+    m_repo.make_new_level_from_coarse(lev, time, ba, new_dm);
+    SetDistributionMap(lev, new_dm);
+    lb.reset_level(lev, ba, new_dm);
 }
 
 // Remake an existing level using provided BoxArray and DistributionMapping and
@@ -30,7 +35,12 @@ void incflo::RemakeLevel(
         amrex::Print() << "Remaking level " << lev << std::endl;
     }
 
-    m_repo.remake_level(lev, time, ba, dm);
+    // Distribute the new boxes based on the work measured on the old ones
+    auto& lb = m_sim.load_balancer();
+    const auto new_dm = lb.distribution_map(lev, ba, dm);
+    m_repo.remake_level(lev, time, ba, new_dm);
+    SetDistributionMap(lev, new_dm);
+    lb.reset_level(lev, ba, new_dm);
 }
 
 // Delete level data
@@ -39,4 +49,5 @@ void incflo::ClearLevel(int lev)
 {
     BL_PROFILE("amr-wind::incflo::ClearLevel()");
     m_repo.clear_level(lev);
+    m_sim.load_balancer().clear_level(lev);
 }
@@ -6,7 +6,13 @@
 int main(int argc, char* argv[])
 {
 #ifdef AMREX_USE_MPI
+#ifdef AMREX_MPI_THREAD_MULTIPLE
+    // Asynchronous output performs MPI calls from a background thread
+    int provided = -1;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+#else
     MPI_Init(&argc, &argv);
+#endif
 #endif
 
     if (argc < 2) {
@@ -50,6 +56,14 @@ int main(int argc, char* argv[])
         if (!pp.contains("signal_handling")) {
             pp.add("signal_handling", 0);
         }
+
+        // Asynchronous checkpoints rely on the AMReX asynchronous output
+        // thread, enable it unless the user explicitly disabled it
+        bool async_checkpoint = false;
+        amrex::ParmParse("io").query("async_checkpoint", async_checkpoint);
+        if (async_checkpoint && !pp.contains("async_out")) {
+            pp.add("async_out", 1);
+        }
     });
 
     { /* These braces are necessary to ensure amrex::Finalize() can be called
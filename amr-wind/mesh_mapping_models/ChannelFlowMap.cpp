@@ -46,213 +46,12 @@ ChannelFlowMap::ChannelFlowMap()
     pp.queryarr("beta", m_beta, 0, AMREX_SPACEDIM);
 }
 
-/** Construct the mesh mapping field
+/** Construct the 1-D mesh mapping arrays in every direction
+ *
+ *  The scaling factors are set to one and the coordinates are left unmapped
+ *  outside the domain.
  */
 void ChannelFlowMap::create_map(int lev, const amrex::Geometry& geom)
-{
-    create_cell_node_map(lev, geom);
-    create_face_map(lev, geom);
-    create_non_uniform_mesh(lev, geom);
-}
-
-/** Construct the mesh mapping field on cell centers and nodes
- */
-void ChannelFlowMap::create_cell_node_map(int lev, const amrex::Geometry& geom)
-{
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> beta{
-        {m_beta[0], m_beta[1], m_beta[2]}};
-    const auto eps = m_eps;
-
-    const auto& dx = geom.CellSizeArray();
-    const auto& prob_lo = geom.ProbLoArray();
-    const auto& prob_hi = geom.ProbHiArray();
-
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> len{
-        {prob_hi[0] - prob_lo[0], prob_hi[1] - prob_lo[1],
-         prob_hi[2] - prob_lo[2]}};
-
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_cc)(lev)); mfi.isValid(); ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_cc =
-            (*m_mesh_scale_fac_cc)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& scale_detJ_cc =
-            (*m_mesh_scale_detJ_cc)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-                amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
-                amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-
-                amrex::Real fac_x = eval_fac(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real fac_y = eval_fac(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real fac_z = eval_fac(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x > prob_lo[0]) && (x < prob_hi[0]) && (y > prob_lo[1]) &&
-                     (y < prob_hi[1]) && (z > prob_lo[2]) && (z < prob_hi[2]));
-
-                scale_fac_cc(i, j, k, 0) = in_domain ? fac_x : 1.0;
-                scale_fac_cc(i, j, k, 1) = in_domain ? fac_y : 1.0;
-                scale_fac_cc(i, j, k, 2) = in_domain ? fac_z : 1.0;
-
-                scale_detJ_cc(i, j, k) = scale_fac_cc(i, j, k, 0) *
-                                         scale_fac_cc(i, j, k, 1) *
-                                         scale_fac_cc(i, j, k, 2);
-            });
-
-        const auto& nbx = mfi.grownnodaltilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_nd =
-            (*m_mesh_scale_fac_nd)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& scale_detJ_nd =
-            (*m_mesh_scale_detJ_nd)(lev).array(mfi);
-        amrex::ParallelFor(
-            nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + i * dx[0];
-                amrex::Real y = prob_lo[1] + j * dx[1];
-                amrex::Real z = prob_lo[2] + k * dx[2];
-
-                amrex::Real fac_x = eval_fac(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real fac_y = eval_fac(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real fac_z = eval_fac(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x >= prob_lo[0] - eps) && (x <= prob_hi[0] + eps) &&
-                     (y >= prob_lo[1] - eps) && (y <= prob_hi[1] + eps) &&
-                     (z >= prob_lo[2] - eps) && (z <= prob_hi[2] + eps));
-
-                scale_fac_nd(i, j, k, 0) = in_domain ? fac_x : 1.0;
-                scale_fac_nd(i, j, k, 1) = in_domain ? fac_y : 1.0;
-                scale_fac_nd(i, j, k, 2) = in_domain ? fac_z : 1.0;
-
-                scale_detJ_nd(i, j, k) = scale_fac_nd(i, j, k, 0) *
-                                         scale_fac_nd(i, j, k, 1) *
-                                         scale_fac_nd(i, j, k, 2);
-            });
-    }
-
-    // TODO: Call fill patch operators ?
-}
-
-/** Construct the mesh mapping field on cell faces
- */
-void ChannelFlowMap::create_face_map(int lev, const amrex::Geometry& geom)
-{
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> beta{
-        {m_beta[0], m_beta[1], m_beta[2]}};
-    const auto eps = m_eps;
-
-    const auto& dx = geom.CellSizeArray();
-    const auto& prob_lo = geom.ProbLoArray();
-    const auto& prob_hi = geom.ProbHiArray();
-
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> len{
-        {prob_hi[0] - prob_lo[0], prob_hi[1] - prob_lo[1],
-         prob_hi[2] - prob_lo[2]}};
-
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_xf)(lev)); mfi.isValid(); ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_xf =
-            (*m_mesh_scale_fac_xf)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& scale_detJ_xf =
-            (*m_mesh_scale_detJ_xf)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + i * dx[0];
-                amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
-                amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-
-                amrex::Real fac_x = eval_fac(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real fac_y = eval_fac(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real fac_z = eval_fac(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x >= prob_lo[0] - eps) && (x <= prob_hi[0] + eps) &&
-                     (y > prob_lo[1]) && (y < prob_hi[1]) && (z > prob_lo[2]) &&
-                     (z < prob_hi[2]));
-
-                scale_fac_xf(i, j, k, 0) = in_domain ? fac_x : 1.0;
-                scale_fac_xf(i, j, k, 1) = in_domain ? fac_y : 1.0;
-                scale_fac_xf(i, j, k, 2) = in_domain ? fac_z : 1.0;
-
-                scale_detJ_xf(i, j, k) = scale_fac_xf(i, j, k, 0) *
-                                         scale_fac_xf(i, j, k, 1) *
-                                         scale_fac_xf(i, j, k, 2);
-            });
-    }
-
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_yf)(lev)); mfi.isValid(); ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_yf =
-            (*m_mesh_scale_fac_yf)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& scale_detJ_yf =
-            (*m_mesh_scale_detJ_yf)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-                amrex::Real y = prob_lo[1] + j * dx[1];
-                amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-
-                amrex::Real fac_x = eval_fac(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real fac_y = eval_fac(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real fac_z = eval_fac(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x > prob_lo[0]) && (x < prob_hi[0]) &&
-                     (y >= prob_lo[1] - eps) && (y <= prob_hi[1] + eps) &&
-                     (z > prob_lo[2]) && (z < prob_hi[2]));
-
-                scale_fac_yf(i, j, k, 0) = in_domain ? fac_x : 1.0;
-                scale_fac_yf(i, j, k, 1) = in_domain ? fac_y : 1.0;
-                scale_fac_yf(i, j, k, 2) = in_domain ? fac_z : 1.0;
-
-                scale_detJ_yf(i, j, k) = scale_fac_yf(i, j, k, 0) *
-                                         scale_fac_yf(i, j, k, 1) *
-                                         scale_fac_yf(i, j, k, 2);
-            });
-    }
-
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_zf)(lev)); mfi.isValid(); ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_zf =
-            (*m_mesh_scale_fac_zf)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& scale_detJ_zf =
-            (*m_mesh_scale_detJ_zf)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-                amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
-                amrex::Real z = prob_lo[2] + k * dx[2];
-
-                amrex::Real fac_x = eval_fac(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real fac_y = eval_fac(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real fac_z = eval_fac(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x > prob_lo[0]) && (x < prob_hi[0]) && (y > prob_lo[1]) &&
-                     (y < prob_hi[1]) && (z >= prob_lo[2] - eps) &&
-                     (z <= prob_hi[2] + eps));
-
-                scale_fac_zf(i, j, k, 0) = in_domain ? fac_x : 1.0;
-                scale_fac_zf(i, j, k, 1) = in_domain ? fac_y : 1.0;
-                scale_fac_zf(i, j, k, 2) = in_domain ? fac_z : 1.0;
-
-                scale_detJ_zf(i, j, k) = scale_fac_zf(i, j, k, 0) *
-                                         scale_fac_zf(i, j, k, 1) *
-                                         scale_fac_zf(i, j, k, 2);
-            });
-    }
-
-    // TODO: Call fill patch operators ?
-}
-
-/** Construct the non-uniform mesh field
- */
-void ChannelFlowMap::create_non_uniform_mesh(
-    int lev, const amrex::Geometry& geom)
 {
     amrex::Vector<amrex::Real> probhi_physical{{0.0, 0.0, 0.0}};
     {
@@ -266,71 +65,41 @@ void ChannelFlowMap::create_non_uniform_mesh(
         }
     }
 
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> beta{
-        {m_beta[0], m_beta[1], m_beta[2]}};
     const auto eps = m_eps;
-
     const auto& dx = geom.CellSizeArray();
     const auto& prob_lo = geom.ProbLoArray();
     const auto& prob_hi = geom.ProbHiArray();
+    const auto bx = separable_box(geom);
+
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        const amrex::Real beta = m_beta[d];
+        const amrex::Real len = prob_hi[d] - prob_lo[d];
+        const amrex::Real len_physical = probhi_physical[d] - prob_lo[d];
+        const int ncells = bx.length(d);
+
+        amrex::Vector<amrex::Real> fac_cc(ncells);
+        amrex::Vector<amrex::Real> coord_cc(ncells);
+        for (int n = 0; n < ncells; ++n) {
+            const amrex::Real x =
+                prob_lo[d] + (bx.smallEnd(d) + n + 0.5) * dx[d];
+            const bool in_domain = (x > prob_lo[d]) && (x < prob_hi[d]);
+            fac_cc[n] = in_domain ? eval_fac(x, beta, prob_lo[d], len) : 1.0;
+            coord_cc[n] =
+                in_domain ? eval_coord(x, beta, prob_lo[d], len_physical) : x;
+        }
 
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> len{
-        {probhi_physical[0] - prob_lo[0], probhi_physical[1] - prob_lo[1],
-         probhi_physical[2] - prob_lo[2]}};
-
-    for (amrex::MFIter mfi((*m_non_uniform_coord_cc)(lev)); mfi.isValid();
-         ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& nu_coord_cc =
-            (*m_non_uniform_coord_cc)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-                amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
-                amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-
-                amrex::Real x_non_uni =
-                    eval_coord(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real y_non_uni =
-                    eval_coord(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real z_non_uni =
-                    eval_coord(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x > prob_lo[0]) && (x < prob_hi[0]) && (y > prob_lo[1]) &&
-                     (y < prob_hi[1]) && (z > prob_lo[2]) && (z < prob_hi[2]));
-
-                nu_coord_cc(i, j, k, 0) = in_domain ? x_non_uni : x;
-                nu_coord_cc(i, j, k, 1) = in_domain ? y_non_uni : y;
-                nu_coord_cc(i, j, k, 2) = in_domain ? z_non_uni : z;
-            });
-
-        const auto& nbx = mfi.grownnodaltilebox();
-        amrex::Array4<amrex::Real> const& nu_coord_nd =
-            (*m_non_uniform_coord_nd)(lev).array(mfi);
-        amrex::ParallelFor(
-            nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + i * dx[0];
-                amrex::Real y = prob_lo[1] + j * dx[1];
-                amrex::Real z = prob_lo[2] + k * dx[2];
-
-                amrex::Real x_non_uni =
-                    eval_coord(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real y_non_uni =
-                    eval_coord(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real z_non_uni =
-                    eval_coord(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x >= prob_lo[0] - eps) && (x <= prob_hi[0] + eps) &&
-                     (y >= prob_lo[1] - eps) && (y <= prob_hi[1] + eps) &&
-                     (z >= prob_lo[2] - eps) && (z <= prob_hi[2] + eps));
+        amrex::Vector<amrex::Real> fac_nd(ncells + 1);
+        amrex::Vector<amrex::Real> coord_nd(ncells + 1);
+        for (int n = 0; n < ncells + 1; ++n) {
+            const amrex::Real x = prob_lo[d] + (bx.smallEnd(d) + n) * dx[d];
+            const bool in_domain =
+                (x >= prob_lo[d] - eps) && (x <= prob_hi[d] + eps);
+            fac_nd[n] = in_domain ? eval_fac(x, beta, prob_lo[d], len) : 1.0;
+            coord_nd[n] =
+                in_domain ? eval_coord(x, beta, prob_lo[d], len_physical) : x;
+        }
 
-                nu_coord_nd(i, j, k, 0) = in_domain ? x_non_uni : x;
-                nu_coord_nd(i, j, k, 1) = in_domain ? y_non_uni : y;
-                nu_coord_nd(i, j, k, 2) = in_domain ? z_non_uni : z;
-            });
+        set_separable_map(lev, geom, d, fac_cc, fac_nd, coord_cc, coord_nd);
     }
 }
 
@@ -160,12 +160,6 @@ amrex::Real ChannelFlow::compute_error(const IndexSelector& idxOp)
     }
 
     const auto& velocity = m_repo.get_field("velocity");
-    Field const* nu_coord_cc =
-        mesh_mapping ? &(m_repo.get_field("non_uniform_coord_cc")) : nullptr;
-    Field const* mesh_fac_cc =
-        mesh_mapping
-            ? &(m_repo.get_mesh_mapping_field(amr_wind::FieldLoc::CELL))
-            : nullptr;
 
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
@@ -188,12 +182,9 @@ amrex::Real ChannelFlow::compute_error(const IndexSelector& idxOp)
         const auto& vel = velocity(lev);
         auto const& vel_arr = vel.const_arrays();
         auto const& mask_arr = level_mask.const_arrays();
-        amrex::MultiArray4<amrex::Real const> fac_arr =
-            mesh_mapping ? ((*mesh_fac_cc)(lev).const_arrays())
-                         : amrex::MultiArray4<amrex::Real const>();
-        amrex::MultiArray4<amrex::Real const> nu_cc =
-            mesh_mapping ? ((*nu_coord_cc)(lev).const_arrays())
-                         : amrex::MultiArray4<amrex::Real const>();
+        const auto mv = mesh_mapping
+                            ? m_repo.mesh_map().view(lev, FieldLoc::CELL)
+                            : MeshMapView();
 
         error += amrex::ParReduce(
             amrex::TypeList<amrex::ReduceOpSum>{},
@@ -204,15 +195,15 @@ amrex::Real ChannelFlow::compute_error(const IndexSelector& idxOp)
                 auto const& mask_bx = mask_arr[box_no];
 
                 amrex::Real y = mesh_mapping
-                                    ? (nu_cc[box_no](i, j, k, norm_dir))
+                                    ? mv.coord(box_no, i, j, k, norm_dir)
                                     : (prob_lo[norm_dir] +
                                        (idxOp(i, j, k) + 0.5) * dx[norm_dir]);
                 amrex::Real fac_x =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 0) : 1.0;
                 amrex::Real fac_y =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 1) : 1.0;
                 amrex::Real fac_z =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 2) : 1.0;
 
                 const amrex::Real u = vel_bx(i, j, k, flow_dir);
                 const amrex::Real u_exact =
@@ -143,10 +143,12 @@ void ConvectingTaylorVortex::initialize_fields(
     auto& density = m_density(level);
     auto& pressure = m_repo.get_field("p")(level);
     auto& gradp = m_repo.get_field("gp")(level);
-    Field const* nu_coord_cc =
-        mesh_mapping ? &(m_repo.get_field("non_uniform_coord_cc")) : nullptr;
-    Field const* nu_coord_nd =
-        mesh_mapping ? &(m_repo.get_field("non_uniform_coord_nd")) : nullptr;
+    const auto mv_cc = mesh_mapping
+                           ? m_repo.mesh_map().view(level, FieldLoc::CELL)
+                           : MeshMapView();
+    const auto mv_nd = mesh_mapping
+                           ? m_repo.mesh_map().view(level, FieldLoc::NODE)
+                           : MeshMapView();
 
     density.setVal(m_rho);
 
@@ -162,16 +164,16 @@ void ConvectingTaylorVortex::initialize_fields(
 
         auto vel = velocity.array(mfi);
         auto gp = gradp.array(mfi);
-        amrex::Array4<amrex::Real const> nu_cc =
-            mesh_mapping ? ((*nu_coord_cc)(level).const_array(mfi))
-                         : amrex::Array4<amrex::Real const>();
+        const int box_no = mfi.LocalIndex();
 
         amrex::ParallelFor(
             vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = mesh_mapping ? (nu_cc(i, j, k, 0))
-                                             : (prob_lo[0] + (i + 0.5) * dx[0]);
-                amrex::Real y = mesh_mapping ? (nu_cc(i, j, k, 1))
-                                             : (prob_lo[1] + (j + 0.5) * dx[1]);
+                amrex::Real x = mesh_mapping
+                                    ? mv_cc.coord(box_no, i, j, k, 0)
+                                    : (prob_lo[0] + (i + 0.5) * dx[0]);
+                amrex::Real y = mesh_mapping
+                                    ? mv_cc.coord(box_no, i, j, k, 1)
+                                    : (prob_lo[1] + (j + 0.5) * dx[1]);
 
                 vel(i, j, k, 0) = u_exact(u0, v0, omega, x, y, 0.0);
                 vel(i, j, k, 1) = v_exact(u0, v0, omega, x, y, 0.0);
@@ -187,16 +189,15 @@ void ConvectingTaylorVortex::initialize_fields(
         if (activate_pressure) {
             const auto& nbx = mfi.nodaltilebox();
             auto pres = pressure.array(mfi);
-            amrex::Array4<amrex::Real const> nu_nd =
-                mesh_mapping ? ((*nu_coord_nd)(level).const_array(mfi))
-                             : amrex::Array4<amrex::Real const>();
 
             amrex::ParallelFor(
                 nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    amrex::Real x = mesh_mapping ? (nu_nd(i, j, k, 0))
-                                                 : (prob_lo[0] + i * dx[0]);
-                    amrex::Real y = mesh_mapping ? (nu_nd(i, j, k, 1))
-                                                 : (prob_lo[1] + j * dx[1]);
+                    amrex::Real x = mesh_mapping
+                                        ? mv_nd.coord(box_no, i, j, k, 0)
+                                        : (prob_lo[0] + i * dx[0]);
+                    amrex::Real y = mesh_mapping
+                                        ? mv_nd.coord(box_no, i, j, k, 1)
+                                        : (prob_lo[1] + j * dx[1]);
 
                     pres(i, j, k, 0) =
                         -0.25 * (std::cos(2.0 * utils::pi() * x) +
@@ -218,13 +219,6 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
     const auto comp = f_exact.m_comp;
     const auto mesh_mapping = m_mesh_mapping;
 
-    Field const* nu_coord_cc =
-        mesh_mapping ? &(m_repo.get_field("non_uniform_coord_cc")) : nullptr;
-    Field const* mesh_fac_cc =
-        mesh_mapping
-            ? &(m_repo.get_mesh_mapping_field(amr_wind::FieldLoc::CELL))
-            : nullptr;
-
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
 
@@ -262,12 +256,9 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
         const auto& fld = field(lev);
         auto const& fld_arr = fld.const_arrays();
         auto const& mask_arr = level_mask.const_arrays();
-        amrex::MultiArray4<amrex::Real const> fac_arr =
-            mesh_mapping ? ((*mesh_fac_cc)(lev).const_arrays())
-                         : amrex::MultiArray4<amrex::Real const>();
-        amrex::MultiArray4<amrex::Real const> nu_cc =
-            mesh_mapping ? ((*nu_coord_cc)(lev).const_arrays())
-                         : amrex::MultiArray4<amrex::Real const>();
+        const auto mv = mesh_mapping
+                            ? m_repo.mesh_map().view(lev, FieldLoc::CELL)
+                            : MeshMapView();
 
         error += amrex::ParReduce(
             amrex::TypeList<amrex::ReduceOpSum>{},
@@ -277,16 +268,18 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
                 auto const& fld_bx = fld_arr[box_no];
                 auto const& mask_bx = mask_arr[box_no];
 
-                amrex::Real x = mesh_mapping ? (nu_cc[box_no](i, j, k, 0))
-                                             : (prob_lo[0] + (i + 0.5) * dx[0]);
-                amrex::Real y = mesh_mapping ? (nu_cc[box_no](i, j, k, 1))
-                                             : (prob_lo[1] + (j + 0.5) * dx[1]);
+                amrex::Real x = mesh_mapping
+                                    ? mv.coord(box_no, i, j, k, 0)
+                                    : (prob_lo[0] + (i + 0.5) * dx[0]);
+                amrex::Real y = mesh_mapping
+                                    ? mv.coord(box_no, i, j, k, 1)
+                                    : (prob_lo[1] + (j + 0.5) * dx[1]);
                 amrex::Real fac_x =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 0) : 1.0;
                 amrex::Real fac_y =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 1) : 1.0;
                 amrex::Real fac_z =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
+                    mesh_mapping ? mv.fac(box_no, i, j, k, 2) : 1.0;
 
                 const amrex::Real u = fld_bx(i, j, k, comp);
                 const amrex::Real u_exact = f_exact(u0, v0, omega, x, y, time);
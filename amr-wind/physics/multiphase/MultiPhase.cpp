@@ -1,6 +1,7 @@
 #include "amr-wind/physics/multiphase/MultiPhase.H"
 #include "amr-wind/equation_systems/vof/volume_fractions.H"
 #include "amr-wind/CFDSim.H"
+#include "amr-wind/core/LoadBalancer.H"
 #include "AMReX_ParmParse.H"
 #include "amr-wind/fvm/filter.H"
 #include "amr-wind/core/field_ops.H"
@@ -108,6 +109,9 @@ void MultiPhase::post_advance_work()
                            << total_vol - m_total_volfrac << std::endl;
             amrex::Print() << " " << std::endl;
         }
+        if (m_sim.load_balancer().collect_costs()) {
+            add_interface_costs();
+        }
         break;
     case InterfaceCapturingMethod::LS:
         set_density_via_levelset();
@@ -115,6 +119,46 @@ void MultiPhase::post_advance_work()
     };
 }
 
+/** Register the cost of the PLIC reconstruction with the load balancer
+ *
+ *  The split advection scheme fits a plane in every cell containing the
+ *  interface, so boxes with interface cells are more expensive.
+ */
+void MultiPhase::add_interface_costs()
+{
+    BL_PROFILE("amr-wind::multiphase::add_interface_costs");
+    auto& lb = m_sim.load_balancer();
+    const amrex::Real cost_weight = lb.weight("vof", 1.0);
+    const int nlevels = m_sim.repo().num_active_levels();
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& vof = (*m_vof)(lev);
+        const auto& vof_arrs = vof.const_arrays();
+        amrex::Gpu::DeviceVector<int> counts(vof.local_size(), 0);
+        auto* cnt = counts.data();
+
+        amrex::ParallelFor(
+            vof, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::Real vf = vof_arrs[nbx](i, j, k);
+                if ((vf > 0.0) && (std::abs(vf - 1.0) > 1.0e-12)) {
+                    amrex::HostDevice::Atomic::Add(&cnt[nbx], 1);
+                }
+            });
+
+        amrex::Vector<int> h_counts(vof.local_size());
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, counts.begin(), counts.end(),
+            h_counts.begin());
+
+        for (amrex::MFIter mfi(vof); mfi.isValid(); ++mfi) {
+            lb.add_cost(
+                lev, mfi,
+                cost_weight *
+                    static_cast<amrex::Real>(h_counts[mfi.LocalIndex()]));
+        }
+    }
+}
+
 amrex::Real MultiPhase::volume_fraction_sum()
 {
     using namespace amrex;
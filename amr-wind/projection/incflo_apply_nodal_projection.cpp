@@ -131,13 +131,11 @@ void incflo::ApplyProjection(
     auto& pressure = m_repo.get_field("p");
     auto& velocity = icns().fields().field;
     auto& velocity_old = icns().fields().field.state(amr_wind::FieldState::Old);
-    amr_wind::Field const* mesh_fac =
-        mesh_mapping
-            ? &(m_repo.get_mesh_mapping_field(amr_wind::FieldLoc::CELL))
-            : nullptr;
-    amr_wind::Field const* mesh_detJ =
-        mesh_mapping ? &(m_repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::CELL))
-                     : nullptr;
+    auto mesh_view = [&](const int lev) {
+        return mesh_mapping
+                   ? m_sim.mesh_mapping()->view(lev, amr_wind::FieldLoc::CELL)
+                   : amr_wind::MeshMapView();
+    };
 
     // TODO: Mesh mapping doesn't work with immersed boundaries
     // Do the pre pressure correction work -- this applies to IB only
@@ -155,6 +153,7 @@ void incflo::ApplyProjection(
     // dt/rho
     if (!incremental) {
         for (int lev = 0; lev <= finest_level; lev++) {
+            const auto mv = mesh_view(lev);
 
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -165,19 +164,17 @@ void incflo::ApplyProjection(
                 Array4<Real> const& u = velocity(lev).array(mfi);
                 Array4<Real const> const& rho = density[lev]->const_array(mfi);
                 Array4<Real const> const& gp = grad_p(lev).const_array(mfi);
-                amrex::Array4<amrex::Real const> fac =
-                    mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
+                const int nbx = mfi.LocalIndex();
 
                 amrex::ParallelFor(
                     bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                         Real soverrho = scaling_factor / rho(i, j, k);
                         amrex::Real fac_x =
-                            mesh_mapping ? (fac(i, j, k, 0)) : 1.0;
+                            mesh_mapping ? mv.fac(nbx, i, j, k, 0) : 1.0;
                         amrex::Real fac_y =
-                            mesh_mapping ? (fac(i, j, k, 1)) : 1.0;
+                            mesh_mapping ? mv.fac(nbx, i, j, k, 1) : 1.0;
                         amrex::Real fac_z =
-                            mesh_mapping ? (fac(i, j, k, 2)) : 1.0;
+                            mesh_mapping ? mv.fac(nbx, i, j, k, 2) : 1.0;
 
                         u(i, j, k, 0) += 1 / fac_x * gp(i, j, k, 0) * soverrho;
                         u(i, j, k, 1) += 1 / fac_y * gp(i, j, k, 1) * soverrho;
@@ -247,6 +244,7 @@ void incflo::ApplyProjection(
         for (int lev = 0; lev <= finest_level; ++lev) {
             sigma[lev].define(
                 grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+            const auto mv = mesh_view(lev);
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
@@ -255,20 +253,15 @@ void incflo::ApplyProjection(
                 Box const& bx = mfi.tilebox();
                 Array4<Real> const& sig = sigma[lev].array(mfi);
                 Array4<Real const> const& rho = density[lev]->const_array(mfi);
-                amrex::Array4<amrex::Real const> fac =
-                    mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-                amrex::Array4<amrex::Real const> detJ =
-                    mesh_mapping ? ((*mesh_detJ)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
+                const int nbx = mfi.LocalIndex();
 
                 amrex::ParallelFor(
                     bx, ncomp,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
                         amrex::Real fac_cc =
-                            mesh_mapping ? (fac(i, j, k, n)) : 1.0;
+                            mesh_mapping ? mv.fac(nbx, i, j, k, n) : 1.0;
                         amrex::Real det_j =
-                            mesh_mapping ? (detJ(i, j, k)) : 1.0;
+                            mesh_mapping ? mv.detJ(nbx, i, j, k) : 1.0;
                         sig(i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
                                           scaling_factor / rho(i, j, k);
                     });
@@ -276,12 +269,6 @@ void incflo::ApplyProjection(
         }
     }
 
-    // Perform projection
-    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
-
-    auto bclo = get_projection_bc(Orientation::low);
-    auto bchi = get_projection_bc(Orientation::high);
-
     Vector<MultiFab*> vel;
     for (int lev = 0; lev <= finest_level; ++lev) {
         vel.push_back(&(velocity(lev)));
@@ -291,31 +278,51 @@ void incflo::ApplyProjection(
         }
     }
 
-    amr_wind::MLMGOptions options("nodal_proj");
+    // The nodal projector and its multigrid hierarchy are retained across
+    // timesteps and only rebuilt after a regrid. Overset masks change every
+    // timestep, so the projector is always rebuilt for overset simulations.
+    if (m_sim.has_overset() || (m_nodal_proj && (vel != m_nodal_proj_vel))) {
+        m_nodal_proj.reset();
+    }
 
-    if (variable_density || mesh_mapping) {
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
-            options.lpinfo());
-    } else {
-        amrex::Real rho_0 = 1.0;
-        amrex::ParmParse pp("incflo");
-        pp.query("density", rho_0);
+    // For constant density the projector is built with sigma = 1/rho_0 so that
+    // it remains valid when dt changes; the solution is then phi = dt * p and
+    // is rescaled when updating pressure and its gradient.
+    const bool const_sigma = !(variable_density || mesh_mapping);
+    const amrex::Real phi_scale = const_sigma ? 1.0 / scaling_factor : 1.0;
+
+    if (!m_nodal_proj) {
+        if (const_sigma) {
+            m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+                vel, 1.0 / m_rho_0, Geom(0, finest_level),
+                m_nodal_proj_options.lpinfo());
+        } else {
+            m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+                vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
+                m_nodal_proj_options.lpinfo());
+        }
 
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, scaling_factor / rho_0, Geom(0, finest_level),
-            options.lpinfo());
+        // Set MLMG and NodalProjector options
+        m_nodal_proj_options(*m_nodal_proj);
+        m_nodal_proj->setDomainBC(
+            get_projection_bc(Orientation::low),
+            get_projection_bc(Orientation::high));
+        m_nodal_proj_vel = vel;
+    } else if (!const_sigma) {
+        auto& linop = m_nodal_proj->getLinOp();
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            linop.setSigma(lev, sigma[lev]);
+        }
     }
 
-    // Set MLMG and NodalProjector options
-    options(*nodal_projector);
-    nodal_projector->setDomainBC(bclo, bchi);
+    auto& nodal_projector = *m_nodal_proj;
+    const auto& options = m_nodal_proj_options;
 
     bool has_ib = m_sim.physics_manager().contains("IB");
     if (has_ib) {
         auto div_vel_rhs =
             sim().repo().create_scratch_field(1, 0, amr_wind::FieldLoc::NODE);
-        nodal_projector->computeRHS(div_vel_rhs->vec_ptrs(), vel, {}, {});
+        nodal_projector.computeRHS(div_vel_rhs->vec_ptrs(), vel, {}, {});
         // Mask the righ-hand side of the Poisson solve for the nodes inside the
         // body
         auto& imask_node = repo().get_int_field("mask_node");
@@ -324,12 +331,12 @@ void incflo::ApplyProjection(
                 *div_vel_rhs->vec_ptrs()[lev],
                 amrex::ToMultiFab(imask_node(lev)), 0, 0, 1, 0);
         }
-        nodal_projector->setCustomRHS(div_vel_rhs->vec_const_ptrs());
+        nodal_projector.setCustomRHS(div_vel_rhs->vec_const_ptrs());
     }
 
     // Setup masking for overset simulations
     if (sim().has_overset()) {
-        auto& linop = nodal_projector->getLinOp();
+        auto& linop = nodal_projector.getLinOp();
         auto& imask_node = repo().get_int_field("mask_node");
         for (int lev = 0; lev <= finest_level; ++lev) {
             linop.setOversetMask(lev, imask_node(lev));
@@ -344,15 +351,32 @@ void incflo::ApplyProjection(
             }
         } else {
             amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
+            if (const_sigma) {
+                for (int lev = 0; lev <= finestLevel(); ++lev) {
+                    (*phif)(lev).mult(scaling_factor, 0, 1, 1);
+                }
+            }
         }
 
-        nodal_projector->project(
+        nodal_projector.project(
+            phif->vec_ptrs(), options.rel_tol, options.abs_tol);
+    } else if (!incremental && m_nodal_proj_history.enabled()) {
+        // Start from the pressure extrapolated from the previous timesteps
+        auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
+        if (!m_nodal_proj_history.initial_guess(
+                phif->vec_ptrs(), time, 1.0 / phi_scale)) {
+            for (int lev = 0; lev <= finestLevel(); ++lev) {
+                (*phif)(lev).setVal(0.0);
+            }
+        }
+
+        nodal_projector.project(
             phif->vec_ptrs(), options.rel_tol, options.abs_tol);
     } else {
-        nodal_projector->project(options.rel_tol, options.abs_tol);
+        nodal_projector.project(options.rel_tol, options.abs_tol);
     }
     amr_wind::io::print_mlmg_info(
-        "Nodal_projection", nodal_projector->getMLMG());
+        "Nodal_projection", nodal_projector.getMLMG());
 
     // scale U^* back to -> U = fac/J * U^bar
     if (mesh_mapping) {
@@ -368,8 +392,8 @@ void incflo::ApplyProjection(
     }
 
     // Get phi and fluxes
-    auto phi = nodal_projector->getPhi();
-    auto gradphi = nodal_projector->getGradPhi();
+    auto phi = nodal_projector.getPhi();
+    auto gradphi = nodal_projector.getGradPhi();
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
@@ -387,21 +411,21 @@ void incflo::ApplyProjection(
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) += phi_scale * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) += p_proj(i, j, k);
+                        p_lev(i, j, k) += phi_scale * p_proj(i, j, k);
                     });
             } else {
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) = phi_scale * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) = p_proj(i, j, k);
+                        p_lev(i, j, k) = phi_scale * p_proj(i, j, k);
                     });
             }
         }
@@ -412,6 +436,10 @@ void incflo::ApplyProjection(
             grad_p(lev + 1), grad_p(lev), 0, AMREX_SPACEDIM, refRatio(lev));
     }
 
+    if (!incremental) {
+        m_nodal_proj_history.push(pressure.vec_const_ptrs(), time);
+    }
+
     velocity.fillpatch(m_time.new_time());
     if (m_verbose > 2) {
         if (proj_for_small_dt) {
@@ -4,6 +4,7 @@
 #include <cmath>
 
 #include "amr-wind/core/Physics.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/physics/BoussinesqBubble.H"
 #include "amr-wind/utilities/tagging/RefinementCriteria.H"
@@ -26,6 +27,7 @@ void incflo::ReadParameters()
 
         // Physics
         pp.query("constant_density", m_constant_density);
+        pp.query("density", m_rho_0);
 
         // Godunov-related flags
         pp.query("use_godunov", m_use_godunov);
@@ -46,6 +48,14 @@ void incflo::ReadParameters()
                 "Crank-Nicolson or 2 for implicit");
         }
 
+        // Combine the implicit diffusion solves of the scalar equations
+        bool batch_scalar_diffusion = false;
+        pp.query("batch_scalar_diffusion", batch_scalar_diffusion);
+        if (batch_scalar_diffusion) {
+            m_scalar_diff_batch =
+                std::make_unique<amr_wind::pde::ScalarDiffusionBatch>(m_sim);
+        }
+
         if (!m_use_godunov && m_time.max_cfl() > 0.5) {
             amrex::Abort(
                 "We currently require cfl <= 0.5 when using the MOL advection "
@@ -61,6 +71,22 @@ void incflo::ReadParameters()
         // for all other physics
         pp.query("probtype", m_probtype);
 
+        // Recycling of scratch field data between timesteps
+        bool use_scratch_pool = true;
+        amrex::Real scratch_pool_max_mb =
+            static_cast<amrex::Real>(
+                amr_wind::ScratchFieldPool::default_max_pooled_bytes) /
+            (1024.0 * 1024.0);
+        pp.query("use_scratch_pool", use_scratch_pool);
+        pp.query("scratch_pool_max_mb", scratch_pool_max_mb);
+        auto& scratch_pool = m_repo.scratch_pool();
+        scratch_pool.set_enabled(use_scratch_pool);
+        scratch_pool.set_max_pooled_bytes(
+            (scratch_pool_max_mb < 0.0)
+                ? -1
+                : static_cast<amrex::Long>(
+                      scratch_pool_max_mb * 1024.0 * 1024.0));
+
     } // end prefix incflo
 }
 
@@ -160,6 +186,9 @@ void incflo::InitialProjection()
     pressure().setVal(0.0);
     grad_p().setVal(0.0);
 
+    // The initial projection solution does not warm start later projections
+    m_nodal_proj_history.reset();
+
     if (m_verbose != 0) {
         PrintMaxValues("after initial projection");
     }
@@ -1,8 +1,7 @@
 #include "amr-wind/turbulence/LES/OneEqKsgs.H"
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
-#include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/fused_ops.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 
@@ -11,6 +10,57 @@
 namespace amr_wind {
 namespace turbulence {
 
+namespace {
+
+//! M84 closure evaluated along with the strain rate and temperature gradient
+struct KsgsM84Op
+{
+    amrex::Array4<const amrex::Real> vel;
+    amrex::Array4<const amrex::Real> temperature;
+    amrex::Array4<const amrex::Real> rho;
+    amrex::Array4<const amrex::Real> tke;
+    amrex::Array4<amrex::Real> mu_turb;
+    amrex::Array4<amrex::Real> tlscale;
+    amrex::Array4<amrex::Real> buoy_prod;
+    amrex::Array4<amrex::Real> shear_prod;
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity;
+    amrex::Real beta;
+    amrex::Real Ce;
+    amrex::Real ds;
+
+    template <typename Stencil>
+    AMREX_GPU_DEVICE void
+    eval(
+        const int i,
+        const int j,
+        const int k,
+        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& idx) const noexcept
+    {
+        using Deriv = fvm::Derivative<Stencil>;
+        const auto gradT = Deriv::gradient(temperature, i, j, k, 0, idx);
+        const amrex::Real stratification =
+            -(gradT[0] * gravity[0] + gradT[1] * gravity[1] +
+              gradT[2] * gravity[2]) *
+            beta;
+        const amrex::Real tke_val = tke(i, j, k);
+        const amrex::Real tl_val =
+            (stratification > 1e-10)
+                ? amrex::min(ds, 0.76 * std::sqrt(tke_val / stratification))
+                : ds;
+        const amrex::Real mu_val =
+            rho(i, j, k) * Ce * tl_val * std::sqrt(tke_val);
+        const amrex::Real sr = Deriv::strainrate(vel, i, j, k, idx);
+
+        tlscale(i, j, k) = tl_val;
+        mu_turb(i, j, k) = mu_val;
+        buoy_prod(i, j, k) =
+            -mu_val * (1.0 + 2.0 * tl_val / ds) * stratification;
+        shear_prod(i, j, k) = sr * (sr * mu_val);
+    }
+};
+
+} // namespace
+
 template <typename Transport>
 OneEqKsgs<Transport>::OneEqKsgs(CFDSim& sim)
     : TurbModelBase<Transport>(sim)
@@ -90,12 +140,8 @@ void OneEqKsgsM84<Transport>::update_turbulent_viscosity(
     BL_PROFILE(
         "amr-wind::" + this->identifier() + "::update_turbulent_viscosity");
 
-    auto gradT = (this->m_sim.repo()).create_scratch_field(3, 0);
-    fvm::gradient(*gradT, m_temperature.state(fstate));
-
     const auto& vel = this->m_vel.state(fstate);
-    // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
+    const auto& temp = m_temperature.state(fstate);
 
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity{
         {m_gravity[0], m_gravity[1], m_gravity[2]}};
@@ -107,8 +153,9 @@ void OneEqKsgsM84<Transport>::update_turbulent_viscosity(
     auto& repo = mu_turb.repo();
     const auto& geom_vec = repo.mesh().Geom();
 
-    const int nlevels = repo.num_active_levels();
-    for (int lev = 0; lev < nlevels; ++lev) {
+    // Compute the strain rate and temperature gradient along with the
+    // turbulent viscosity and production terms in a single sweep
+    fvm::fused_apply(mu_turb, [&](const int lev, const amrex::MFIter& mfi) {
         const auto& geom = geom_vec[lev];
 
         const amrex::Real dx = geom.CellSize()[0];
@@ -116,45 +163,20 @@ void OneEqKsgsM84<Transport>::update_turbulent_viscosity(
         const amrex::Real dz = geom.CellSize()[2];
         const amrex::Real ds = std::cbrt(dx * dy * dz);
 
-        for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
-            const auto& bx = mfi.tilebox();
-            const auto& mu_arr = mu_turb(lev).array(mfi);
-            const auto& rho_arr = den(lev).const_array(mfi);
-            const auto& gradT_arr = (*gradT)(lev).array(mfi);
-            const auto& tlscale_arr = (this->m_turb_lscale)(lev).array(mfi);
-            const auto& tke_arr = (*this->m_tke)(lev).array(mfi);
-            const auto& buoy_prod_arr = (this->m_buoy_prod)(lev).array(mfi);
-            const auto& shear_prod_arr = (this->m_shear_prod)(lev).array(mfi);
-
-            amrex::ParallelFor(
-                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    amrex::Real stratification =
-                        -(gradT_arr(i, j, k, 0) * gravity[0] +
-                          gradT_arr(i, j, k, 1) * gravity[1] +
-                          gradT_arr(i, j, k, 2) * gravity[2]) *
-                        beta;
-                    if (stratification > 1e-10) {
-                        tlscale_arr(i, j, k) = amrex::min(
-                            ds, 0.76 * std::sqrt(
-                                           tke_arr(i, j, k) / stratification));
-                    } else {
-                        tlscale_arr(i, j, k) = ds;
-                    }
-
-                    mu_arr(i, j, k) = rho_arr(i, j, k) * Ce *
-                                      tlscale_arr(i, j, k) *
-                                      std::sqrt(tke_arr(i, j, k));
-
-                    buoy_prod_arr(i, j, k) =
-                        -mu_arr(i, j, k) *
-                        (1.0 + 2.0 * tlscale_arr(i, j, k) / ds) *
-                        stratification;
-
-                    shear_prod_arr(i, j, k) *=
-                        shear_prod_arr(i, j, k) * mu_arr(i, j, k);
-                });
-        }
-    }
+        return KsgsM84Op{
+            vel(lev).const_array(mfi),
+            temp(lev).const_array(mfi),
+            den(lev).const_array(mfi),
+            (*this->m_tke)(lev).const_array(mfi),
+            mu_turb(lev).array(mfi),
+            (this->m_turb_lscale)(lev).array(mfi),
+            (this->m_buoy_prod)(lev).array(mfi),
+            (this->m_shear_prod)(lev).array(mfi),
+            gravity,
+            beta,
+            Ce,
+            ds};
+    });
 
     mu_turb.fillpatch(this->m_sim.time().current_time());
 }
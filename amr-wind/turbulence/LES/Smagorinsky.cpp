@@ -2,7 +2,7 @@
 
 #include "amr-wind/turbulence/LES/Smagorinsky.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/fused_ops.H"
 #include "AMReX_REAL.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_ParmParse.H"
@@ -10,6 +10,32 @@
 namespace amr_wind {
 namespace turbulence {
 
+namespace {
+
+//! Smagorinsky closure evaluated along with the strain rate
+struct SmagorinskyOp
+{
+    amrex::Array4<const amrex::Real> vel;
+    amrex::Array4<const amrex::Real> rho;
+    amrex::Array4<amrex::Real> mu_turb;
+    amrex::Real smag_factor;
+
+    template <typename Stencil>
+    AMREX_GPU_DEVICE void
+    eval(
+        const int i,
+        const int j,
+        const int k,
+        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& idx) const noexcept
+    {
+        const amrex::Real sr =
+            fvm::Derivative<Stencil>::strainrate(vel, i, j, k, idx);
+        mu_turb(i, j, k) = rho(i, j, k) * smag_factor * sr;
+    }
+};
+
+} // namespace
+
 template <typename Transport>
 Smagorinsky<Transport>::Smagorinsky(CFDSim& sim)
     : TurbModelBase<Transport>(sim)
@@ -30,12 +56,8 @@ void Smagorinsky<Transport>::update_turbulent_viscosity(const FieldState fstate)
     const auto& geom_vec = repo.mesh().Geom();
     const amrex::Real Cs_sqr = this->m_Cs * this->m_Cs;
 
-    // Populate strainrate into the turbulent viscosity arrays to avoid creating
-    // a temporary buffer
-    fvm::strainrate(mu_turb, vel);
-
-    const int nlevels = repo.num_active_levels();
-    for (int lev = 0; lev < nlevels; ++lev) {
+    // Compute the strain rate and the turbulent viscosity in a single sweep
+    fvm::fused_apply(mu_turb, [&](const int lev, const amrex::MFIter& mfi) {
         const auto& geom = geom_vec[lev];
 
         const amrex::Real dx = geom.CellSize()[0];
@@ -43,20 +65,11 @@ void Smagorinsky<Transport>::update_turbulent_viscosity(const FieldState fstate)
         const amrex::Real dz = geom.CellSize()[2];
         const amrex::Real ds = std::cbrt(dx * dy * dz);
         const amrex::Real ds_sqr = ds * ds;
-        const amrex::Real smag_factor = Cs_sqr * ds_sqr;
-
-        for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
-            const auto& bx = mfi.tilebox();
-            const auto& mu_arr = mu_turb(lev).array(mfi);
-            const auto& rho_arr = den(lev).const_array(mfi);
-
-            amrex::ParallelFor(
-                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    const amrex::Real rho = rho_arr(i, j, k);
-                    mu_arr(i, j, k) *= rho * smag_factor;
-                });
-        }
-    }
+
+        return SmagorinskyOp{
+            vel(lev).const_array(mfi), den(lev).const_array(mfi),
+            mu_turb(lev).array(mfi), Cs_sqr * ds_sqr};
+    });
 
     mu_turb.fillpatch(this->m_sim.time().current_time());
 }
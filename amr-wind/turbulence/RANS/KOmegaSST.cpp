@@ -2,8 +2,7 @@
 #include "amr-wind/turbulence/RANS/KOmegaSSTI.H"
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
-#include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/fused_ops.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 #include "amr-wind/equation_systems/sdr/SDR.H"
@@ -13,6 +12,98 @@
 namespace amr_wind {
 namespace turbulence {
 
+namespace {
+
+//! SST closure evaluated along with the strain rate and the TKE/SDR gradients
+struct KOmegaSSTOp
+{
+    amrex::Array4<const amrex::Real> vel;
+    amrex::Array4<const amrex::Real> tke;
+    amrex::Array4<const amrex::Real> sdr;
+    amrex::Array4<const amrex::Real> rho;
+    amrex::Array4<const amrex::Real> lam_mu;
+    amrex::Array4<const amrex::Real> wd;
+    amrex::Array4<amrex::Real> mu_turb;
+    amrex::Array4<amrex::Real> f1;
+    amrex::Array4<amrex::Real> shear_prod;
+    amrex::Array4<amrex::Real> diss;
+    amrex::Array4<amrex::Real> sdr_src;
+    amrex::Array4<amrex::Real> sdr_diss;
+    amrex::Array4<amrex::Real> tke_lhs;
+    amrex::Array4<amrex::Real> sdr_lhs;
+    amrex::Real beta_star;
+    amrex::Real alpha1;
+    amrex::Real alpha2;
+    amrex::Real beta1;
+    amrex::Real beta2;
+    amrex::Real sigma_omega2;
+    amrex::Real a1;
+    amrex::Real deltaT;
+
+    template <typename Stencil>
+    AMREX_GPU_DEVICE void
+    eval(
+        const int i,
+        const int j,
+        const int k,
+        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& idx) const noexcept
+    {
+        using Deriv = fvm::Derivative<Stencil>;
+        const auto gradK = Deriv::gradient(tke, i, j, k, 0, idx);
+        const auto gradOmega = Deriv::gradient(sdr, i, j, k, 0, idx);
+        const amrex::Real rho_val = rho(i, j, k);
+        const amrex::Real tke_val = tke(i, j, k);
+        const amrex::Real sdr_val = sdr(i, j, k);
+        const amrex::Real wd_val = wd(i, j, k);
+
+        amrex::Real gko =
+            (gradK[0] * gradOmega[0] + gradK[1] * gradOmega[1] +
+             gradK[2] * gradOmega[2]);
+
+        amrex::Real cdkomega = amrex::max(
+            1e-10, 2.0 * rho_val * sigma_omega2 * gko / (sdr_val + 1e-15));
+
+        amrex::Real tmp1 = 4.0 * rho_val * sigma_omega2 * tke_val /
+                           (cdkomega * wd_val * wd_val);
+        amrex::Real tmp2 =
+            std::sqrt(tke_val) / (beta_star * sdr_val * wd_val + 1e-15);
+        amrex::Real tmp3 = 500.0 * lam_mu(i, j, k) /
+                           (wd_val * wd_val * sdr_val * rho_val + 1e-15);
+        amrex::Real tmp4 = Deriv::strainrate(vel, i, j, k, idx);
+
+        amrex::Real arg1 = amrex::min(amrex::max(tmp2, tmp3), tmp1);
+        amrex::Real tmp_f1 = std::tanh(arg1 * arg1 * arg1 * arg1);
+
+        amrex::Real alpha = tmp_f1 * (alpha1 - alpha2) + alpha2;
+        amrex::Real beta = tmp_f1 * (beta1 - beta2) + beta2;
+
+        amrex::Real arg2 = amrex::max(2.0 * tmp2, tmp3);
+        amrex::Real f2 = std::tanh(arg2 * arg2);
+
+        const amrex::Real mu_val =
+            rho_val * a1 * tke_val / amrex::max(a1 * sdr_val, tmp4 * f2);
+        mu_turb(i, j, k) = mu_val;
+
+        f1(i, j, k) = tmp_f1;
+
+        diss(i, j, k) = -beta_star * rho_val * tke_val * sdr_val;
+        tke_lhs(i, j, k) = 0.5 * beta_star * rho_val * sdr_val * deltaT;
+
+        const amrex::Real sp_val = amrex::min(
+            mu_val * tmp4 * tmp4,
+            10.0 * beta_star * rho_val * tke_val * sdr_val);
+        shear_prod(i, j, k) = sp_val;
+
+        sdr_lhs(i, j, k) = 0.5 * rho_val * beta * sdr_val * deltaT;
+        sdr_src(i, j, k) =
+            rho_val * alpha * sp_val / amrex::max(mu_val, 1.0e-16) +
+            (1.0 - tmp_f1) * cdkomega;
+        sdr_diss(i, j, k) = -rho_val * beta * sdr_val * sdr_val;
+    }
+};
+
+} // namespace
+
 template <typename Transport>
 void KOmegaSST<Transport>::parse_model_coeffs()
 {
@@ -64,19 +155,7 @@ void KOmegaSST<Transport>::update_turbulent_viscosity(const FieldState fstate)
     const auto& den = this->m_rho.state(fstate);
     const auto& tke = (*this->m_tke).state(fstate);
     const auto& sdr = (*this->m_sdr).state(fstate);
-    auto& repo = mu_turb.repo();
-
-    const int nlevels = repo.num_active_levels();
-
-    auto gradK = (this->m_sim.repo()).create_scratch_field(3, 0);
-    fvm::gradient(*gradK, tke);
-
-    auto gradOmega = (this->m_sim.repo()).create_scratch_field(3, 0);
-    fvm::gradient(*gradOmega, sdr);
-
     const auto& vel = this->m_vel.state(fstate);
-    // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
 
     auto& tke_lhs = (this->m_sim).repo().get_field("tke_lhs_src_term");
     tke_lhs.setVal(0.0);
@@ -84,87 +163,33 @@ void KOmegaSST<Transport>::update_turbulent_viscosity(const FieldState fstate)
 
     const amrex::Real deltaT = (this->m_sim).time().deltaT();
 
-    for (int lev = 0; lev < nlevels; ++lev) {
-        for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
-            const auto& bx = mfi.tilebox();
-            const auto& lam_mu_arr = (*lam_mu)(lev).array(mfi);
-            const auto& mu_arr = mu_turb(lev).array(mfi);
-            const auto& rho_arr = den(lev).const_array(mfi);
-            const auto& gradK_arr = (*gradK)(lev).array(mfi);
-            const auto& gradOmega_arr = (*gradOmega)(lev).array(mfi);
-            const auto& tke_arr = tke(lev).array(mfi);
-            const auto& sdr_arr = sdr(lev).array(mfi);
-            const auto& wd_arr = (this->m_walldist)(lev).array(mfi);
-            const auto& shear_prod_arr = (this->m_shear_prod)(lev).array(mfi);
-            const auto& diss_arr = (this->m_diss)(lev).array(mfi);
-            const auto& sdr_src_arr = (this->m_sdr_src)(lev).array(mfi);
-            const auto& sdr_diss_arr = (this->m_sdr_diss)(lev).array(mfi);
-            const auto& f1_arr = (this->m_f1)(lev).array(mfi);
-            const auto& tke_lhs_arr = tke_lhs(lev).array(mfi);
-            const auto& sdr_lhs_arr = sdr_lhs(lev).array(mfi);
-
-            amrex::ParallelFor(
-                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    amrex::Real gko =
-                        (gradK_arr(i, j, k, 0) * gradOmega_arr(i, j, k, 0) +
-                         gradK_arr(i, j, k, 1) * gradOmega_arr(i, j, k, 1) +
-                         gradK_arr(i, j, k, 2) * gradOmega_arr(i, j, k, 2));
-
-                    amrex::Real cdkomega = amrex::max(
-                        1e-10, 2.0 * rho_arr(i, j, k) * sigma_omega2 * gko /
-                                   (sdr_arr(i, j, k) + 1e-15));
-
-                    amrex::Real tmp1 =
-                        4.0 * rho_arr(i, j, k) * sigma_omega2 *
-                        tke_arr(i, j, k) /
-                        (cdkomega * wd_arr(i, j, k) * wd_arr(i, j, k));
-                    amrex::Real tmp2 =
-                        std::sqrt(tke_arr(i, j, k)) /
-                        (beta_star * sdr_arr(i, j, k) * wd_arr(i, j, k) +
-                         1e-15);
-                    amrex::Real tmp3 =
-                        500.0 * lam_mu_arr(i, j, k) /
-                        (wd_arr(i, j, k) * wd_arr(i, j, k) * sdr_arr(i, j, k) *
-                             rho_arr(i, j, k) +
-                         1e-15);
-                    amrex::Real tmp4 = shear_prod_arr(i, j, k);
-
-                    amrex::Real arg1 = amrex::min(amrex::max(tmp2, tmp3), tmp1);
-                    amrex::Real tmp_f1 = std::tanh(arg1 * arg1 * arg1 * arg1);
-
-                    amrex::Real alpha = tmp_f1 * (alpha1 - alpha2) + alpha2;
-                    amrex::Real beta = tmp_f1 * (beta1 - beta2) + beta2;
-
-                    amrex::Real arg2 = amrex::max(2.0 * tmp2, tmp3);
-                    amrex::Real f2 = std::tanh(arg2 * arg2);
-
-                    mu_arr(i, j, k) =
-                        rho_arr(i, j, k) * a1 * tke_arr(i, j, k) /
-                        amrex::max(a1 * sdr_arr(i, j, k), tmp4 * f2);
-
-                    f1_arr(i, j, k) = tmp_f1;
-
-                    diss_arr(i, j, k) = -beta_star * rho_arr(i, j, k) *
-                                        tke_arr(i, j, k) * sdr_arr(i, j, k);
-                    tke_lhs_arr(i, j, k) = 0.5 * beta_star * rho_arr(i, j, k) *
-                                           sdr_arr(i, j, k) * deltaT;
-
-                    shear_prod_arr(i, j, k) = amrex::min(
-                        mu_arr(i, j, k) * tmp4 * tmp4,
-                        10.0 * beta_star * rho_arr(i, j, k) * tke_arr(i, j, k) *
-                            sdr_arr(i, j, k));
-
-                    sdr_lhs_arr(i, j, k) = 0.5 * rho_arr(i, j, k) * beta *
-                                           sdr_arr(i, j, k) * deltaT;
-                    sdr_src_arr(i, j, k) =
-                        rho_arr(i, j, k) * alpha * shear_prod_arr(i, j, k) /
-                            amrex::max(mu_arr(i, j, k), 1.0e-16) +
-                        (1.0 - tmp_f1) * cdkomega;
-                    sdr_diss_arr(i, j, k) = -rho_arr(i, j, k) * beta *
-                                            sdr_arr(i, j, k) * sdr_arr(i, j, k);
-                });
-        }
-    }
+    // Compute the strain rate and the TKE/SDR gradients along with the
+    // turbulent viscosity and the source terms in a single sweep
+    fvm::fused_apply(mu_turb, [&](const int lev, const amrex::MFIter& mfi) {
+        return KOmegaSSTOp{
+            vel(lev).const_array(mfi),
+            tke(lev).const_array(mfi),
+            sdr(lev).const_array(mfi),
+            den(lev).const_array(mfi),
+            (*lam_mu)(lev).const_array(mfi),
+            (this->m_walldist)(lev).const_array(mfi),
+            mu_turb(lev).array(mfi),
+            (this->m_f1)(lev).array(mfi),
+            (this->m_shear_prod)(lev).array(mfi),
+            (this->m_diss)(lev).array(mfi),
+            (this->m_sdr_src)(lev).array(mfi),
+            (this->m_sdr_diss)(lev).array(mfi),
+            tke_lhs(lev).array(mfi),
+            sdr_lhs(lev).array(mfi),
+            beta_star,
+            alpha1,
+            alpha2,
+            beta1,
+            beta2,
+            sigma_omega2,
+            a1,
+            deltaT};
+    });
 
     mu_turb.fillpatch(this->m_sim.time().current_time());
 }
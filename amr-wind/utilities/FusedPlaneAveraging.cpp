@@ -0,0 +1,395 @@
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+
+#include <algorithm>
+#include <utility>
+
+namespace amr_wind {
+
+int FusedPlaneAveraging::field_index(FieldPlaneAveraging& pa)
+{
+    auto found = std::find(m_averages.begin(), m_averages.end(), &pa);
+    if (found != m_averages.end()) {
+        return static_cast<int>(found - m_averages.begin());
+    }
+
+    if (!m_averages.empty()) {
+        const auto& pa0 = *m_averages[0];
+        AMREX_ALWAYS_ASSERT(pa.axis() == pa0.axis());
+        AMREX_ALWAYS_ASSERT(pa.level() == pa0.level());
+        AMREX_ALWAYS_ASSERT(pa.ncell_plane() == pa0.ncell_plane());
+        AMREX_ALWAYS_ASSERT(pa.ncell_line() == pa0.ncell_line());
+    }
+
+    const int fidx = static_cast<int>(m_averages.size());
+    m_averages.push_back(&pa);
+
+    amrex::Vector<int> mean_terms(pa.ncomp());
+    for (int n = 0; n < pa.ncomp(); ++n) {
+        mean_terms[n] = term_index(1, &fidx, &n);
+    }
+    m_mean_terms.push_back(std::move(mean_terms));
+
+    return fidx;
+}
+
+int FusedPlaneAveraging::term_index(int nfac, const int* field, const int* comp)
+{
+    AMREX_ASSERT(nfac <= 3);
+
+    Term term;
+    term.nfac = nfac;
+    const int nf = amrex::max(nfac, 1);
+    std::array<std::pair<int, int>, 3> factors;
+    for (int n = 0; n < nf; ++n) {
+        factors[n] = std::make_pair(field[n], comp[n]);
+    }
+    // Products commute, sort the factors so that <u'v'> and <v'u'> are only
+    // accumulated once
+    if (nfac > 1) {
+        std::sort(factors.begin(), factors.begin() + nfac);
+    }
+
+    std::array<int, 7> key;
+    key.fill(-1);
+    key[0] = nfac;
+    for (int n = 0; n < nf; ++n) {
+        term.field[n] = factors[n].first;
+        term.comp[n] = factors[n].second;
+        key[1 + 2 * n] = factors[n].first;
+        key[2 + 2 * n] = factors[n].second;
+    }
+    // The hvelmag term uses the second component of the field
+    if (nfac == 0) {
+        term.comp[1] = comp[1];
+        key[3] = comp[1];
+    }
+
+    auto found = m_term_map.find(key);
+    if (found != m_term_map.end()) {
+        return found->second;
+    }
+
+    const int tidx = num_terms();
+    m_terms.push_back(term);
+    m_term_map[key] = tidx;
+    return tidx;
+}
+
+void FusedPlaneAveraging::add(FieldPlaneAveraging& pa) { field_index(pa); }
+
+void FusedPlaneAveraging::add(VelPlaneAveraging& pa)
+{
+    const int fidx = field_index(pa);
+
+    for (const auto& hv : m_hvelmag) {
+        if (hv.first == &pa) {
+            return;
+        }
+    }
+
+    int comps[2] = {0, 1};
+    switch (pa.axis()) {
+    case 0:
+        comps[0] = 1;
+        comps[1] = 2;
+        break;
+    case 1:
+        comps[0] = 0;
+        comps[1] = 2;
+        break;
+    default:
+        break;
+    }
+    m_hvelmag.emplace_back(&pa, term_index(0, &fidx, comps));
+}
+
+void FusedPlaneAveraging::add(SecondMomentAveraging& sm)
+{
+    SecondMoment entry;
+    entry.sm = &sm;
+    entry.fidx[0] = field_index(sm.m_plane_average1);
+    entry.fidx[1] = field_index(sm.m_plane_average2);
+
+    const int ncomp1 = sm.m_plane_average1.ncomp();
+    const int ncomp2 = sm.m_plane_average2.ncomp();
+    for (int m = 0; m < ncomp1; ++m) {
+        for (int n = 0; n < ncomp2; ++n) {
+            const int comp[2] = {m, n};
+            entry.terms.push_back(term_index(2, entry.fidx, comp));
+        }
+    }
+    m_second.push_back(std::move(entry));
+}
+
+void FusedPlaneAveraging::add(ThirdMomentAveraging& tm)
+{
+    ThirdMoment entry;
+    entry.tm = &tm;
+    entry.fidx[0] = field_index(tm.m_plane_average1);
+    entry.fidx[1] = field_index(tm.m_plane_average2);
+    entry.fidx[2] = field_index(tm.m_plane_average3);
+
+    const int* fidx = entry.fidx;
+    const int fac[] = {fidx[0], fidx[2], fidx[1], fidx[2]};
+    const int ncomp1 = tm.m_plane_average1.ncomp();
+    const int ncomp2 = tm.m_plane_average2.ncomp();
+    const int ncomp3 = tm.m_plane_average3.ncomp();
+    for (int m = 0; m < ncomp1; ++m) {
+        for (int n = 0; n < ncomp2; ++n) {
+            for (int p = 0; p < ncomp3; ++p) {
+                const int comp[] = {m, n, p};
+                const int comp_ac[] = {m, p};
+                const int comp_bc[] = {n, p};
+                entry.terms.push_back(
+                    {term_index(3, fidx, comp), term_index(2, fidx, comp),
+                     term_index(2, &fac[0], comp_ac),
+                     term_index(2, &fac[2], comp_bc)});
+            }
+        }
+    }
+    m_third.push_back(std::move(entry));
+}
+
+void FusedPlaneAveraging::operator()()
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::operator");
+
+    if (m_averages.empty()) {
+        return;
+    }
+
+    // The previous line averages are used to shift the fields before
+    // accumulating the products
+    amrex::Vector<amrex::Real> shift;
+    for (const auto* pa : m_averages) {
+        shift.insert(
+            shift.end(), pa->line_average().begin(),
+            pa->line_average().end());
+    }
+
+    const auto& pa0 = *m_averages[0];
+    amrex::Vector<amrex::Real> sums(
+        static_cast<size_t>(pa0.ncell_line()) * num_terms(), 0.0);
+
+    switch (pa0.axis()) {
+    case 0:
+        compute_sums(XDir(), shift, sums);
+        break;
+    case 1:
+        compute_sums(YDir(), shift, sums);
+        break;
+    case 2:
+        compute_sums(ZDir(), shift, sums);
+        break;
+    default:
+        amrex::Abort("axis must be equal to 0, 1, or 2");
+        break;
+    }
+
+    finalize(shift, sums);
+}
+
+template <typename IndexSelector>
+void FusedPlaneAveraging::compute_sums(
+    const IndexSelector& idxOp,
+    const amrex::Vector<amrex::Real>& shift,
+    amrex::Vector<amrex::Real>& sums)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::compute_sums");
+
+    const auto& pa0 = *m_averages[0];
+    const int level = pa0.level();
+    const int nfields = static_cast<int>(m_averages.size());
+    const int nterms = num_terms();
+    const amrex::Real denom = 1.0 / (amrex::Real)pa0.ncell_plane();
+    const auto& mfab0 = pa0.field()(level);
+
+    // Offset into the shift array and number of components for every field
+    amrex::Vector<int> finfo(2 * nfields);
+    // Arrays for every field on every local box
+    amrex::Vector<amrex::Array4<const amrex::Real>> farrs(
+        static_cast<size_t>(mfab0.local_size()) * nfields);
+    int offset = 0;
+    for (int f = 0; f < nfields; ++f) {
+        const auto& pa = *m_averages[f];
+        const auto& mfab = pa.field()(level);
+        AMREX_ALWAYS_ASSERT(mfab.boxArray() == mfab0.boxArray());
+        AMREX_ALWAYS_ASSERT(mfab.DistributionMap() == mfab0.DistributionMap());
+
+        finfo[2 * f] = offset;
+        finfo[2 * f + 1] = pa.ncomp();
+        offset += pa.ncomp() * pa.ncell_line();
+
+        for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+            farrs[mfi.LocalIndex() * nfields + f] = mfab.const_array(mfi);
+        }
+    }
+
+    amrex::AsyncArray<amrex::Array4<const amrex::Real>> d_farrs(
+        farrs.data(), farrs.size());
+    amrex::AsyncArray<Term> d_terms(m_terms.data(), m_terms.size());
+    amrex::AsyncArray<int> d_finfo(finfo.data(), finfo.size());
+    amrex::AsyncArray<amrex::Real> d_shift(shift.data(), shift.size());
+    amrex::AsyncArray<amrex::Real> d_sums(sums.data(), sums.size());
+
+    const auto* terms = d_terms.data();
+    const auto* fld_info = d_finfo.data();
+    const auto* line_shift = d_shift.data();
+    amrex::Real* line_sums = d_sums.data();
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab0, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        amrex::Box bx = mfi.tilebox();
+
+        const auto* arrs = d_farrs.data() + mfi.LocalIndex() * nfields;
+
+        amrex::Box pbx =
+            PerpendicularBox<IndexSelector>(bx, amrex::IntVect{0, 0, 0});
+
+        amrex::ParallelFor(
+            amrex::Gpu::KernelInfo().setReduction(true), pbx,
+            [=] AMREX_GPU_DEVICE(
+                int p_i, int p_j, int p_k,
+                amrex::Gpu::Handler const& handler) noexcept {
+                // Loop over the direction perpendicular to the plane.
+                // This reduces the atomic pressure on the destination arrays.
+
+                amrex::Box lbx = ParallelBox<IndexSelector>(
+                    bx, amrex::IntVect{p_i, p_j, p_k});
+
+                for (int k = lbx.smallEnd(2); k <= lbx.bigEnd(2); ++k) {
+                    for (int j = lbx.smallEnd(1); j <= lbx.bigEnd(1); ++j) {
+                        for (int i = lbx.smallEnd(0); i <= lbx.bigEnd(0); ++i) {
+
+                            const int ind = idxOp(i, j, k);
+
+                            for (int t = 0; t < nterms; ++t) {
+                                const auto& term = terms[t];
+                                amrex::Real val = 1.0;
+                                if (term.nfac == 0) {
+                                    const auto& arr = arrs[term.field[0]];
+                                    const amrex::Real u1 =
+                                        arr(i, j, k, term.comp[0]);
+                                    const amrex::Real u2 =
+                                        arr(i, j, k, term.comp[1]);
+                                    val = std::sqrt(u1 * u1 + u2 * u2);
+                                }
+                                for (int n = 0; n < term.nfac; ++n) {
+                                    const int f = term.field[n];
+                                    const int c = term.comp[n];
+                                    const int soff = fld_info[2 * f] +
+                                                     fld_info[2 * f + 1] * ind +
+                                                     c;
+                                    val *= arrs[f](i, j, k, c) -
+                                           line_shift[soff];
+                                }
+
+                                amrex::Gpu::deviceReduceSum(
+                                    &line_sums[nterms * ind + t], val * denom,
+                                    handler);
+                            }
+                        }
+                    }
+                }
+            });
+    }
+
+    d_sums.copyToHost(sums.data(), sums.size());
+    amrex::ParallelDescriptor::ReduceRealSum(sums.data(), sums.size());
+}
+
+void FusedPlaneAveraging::finalize(
+    const amrex::Vector<amrex::Real>& shift,
+    const amrex::Vector<amrex::Real>& sums)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::finalize");
+
+    const int nterms = num_terms();
+    const int ncell_line = m_averages[0]->ncell_line();
+
+    // Averages of the shifted fields
+    const auto mean = [&](int fidx, int comp, int ind) {
+        return sums[nterms * ind + mean_term(fidx, comp)];
+    };
+
+    int offset = 0;
+    for (int f = 0; f < static_cast<int>(m_averages.size()); ++f) {
+        auto& pa = *m_averages[f];
+        const int ncomp = pa.ncomp();
+        for (int ind = 0; ind < ncell_line; ++ind) {
+            for (int n = 0; n < ncomp; ++n) {
+                const int idx = ncomp * ind + n;
+                pa.m_line_average[idx] = shift[offset + idx] + mean(f, n, ind);
+            }
+        }
+        offset += ncomp * ncell_line;
+
+        pa.m_last_updated_index = pa.m_time.time_index();
+        if (pa.m_comp_deriv) {
+            pa.compute_line_derivatives();
+        }
+    }
+
+    for (const auto& hv : m_hvelmag) {
+        auto& vpa = *hv.first;
+        for (int ind = 0; ind < ncell_line; ++ind) {
+            vpa.m_line_hvelmag_average[ind] = sums[nterms * ind + hv.second];
+        }
+        if (vpa.m_comp_deriv) {
+            vpa.compute_line_hvelmag_derivatives();
+        }
+    }
+
+    for (const auto& entry : m_second) {
+        auto& sm = *entry.sm;
+        const int ncomp1 = sm.m_plane_average1.ncomp();
+        const int ncomp2 = sm.m_plane_average2.ncomp();
+        const int nmoments = sm.m_num_moments;
+        for (int ind = 0; ind < ncell_line; ++ind) {
+            int nf = 0;
+            for (int m = 0; m < ncomp1; ++m) {
+                const amrex::Real a = mean(entry.fidx[0], m, ind);
+                for (int n = 0; n < ncomp2; ++n) {
+                    const amrex::Real b = mean(entry.fidx[1], n, ind);
+                    const amrex::Real ab = sums[nterms * ind + entry.terms[nf]];
+                    sm.m_second_moments_line[nmoments * ind + nf] = ab - a * b;
+                    ++nf;
+                }
+            }
+        }
+        sm.m_last_updated_index = sm.m_plane_average1.last_updated_index();
+    }
+
+    for (const auto& entry : m_third) {
+        auto& tm = *entry.tm;
+        const int ncomp1 = tm.m_plane_average1.ncomp();
+        const int ncomp2 = tm.m_plane_average2.ncomp();
+        const int ncomp3 = tm.m_plane_average3.ncomp();
+        const int nmoments = tm.m_num_moments;
+        for (int ind = 0; ind < ncell_line; ++ind) {
+            const amrex::Real* lsums = &sums[nterms * ind];
+            int nf = 0;
+            for (int m = 0; m < ncomp1; ++m) {
+                const amrex::Real a = mean(entry.fidx[0], m, ind);
+                for (int n = 0; n < ncomp2; ++n) {
+                    const amrex::Real b = mean(entry.fidx[1], n, ind);
+                    for (int p = 0; p < ncomp3; ++p) {
+                        const amrex::Real c = mean(entry.fidx[2], p, ind);
+                        const auto& tt = entry.terms[nf];
+                        tm.m_third_moments_line[nmoments * ind + nf] =
+                            lsums[tt[0]] - a * lsums[tt[3]] -
+                            b * lsums[tt[2]] - c * lsums[tt[1]] +
+                            2.0 * a * b * c;
+                        ++nf;
+                    }
+                }
+            }
+        }
+        tm.m_last_updated_index = tm.m_plane_average1.last_updated_index();
+    }
+}
+
+} // namespace amr_wind
@@ -3,6 +3,8 @@
 #include <chrono>
 #include <ctime>
 #include <fstream>
+#include <map>
+#include <sstream>
 
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/CFDSim.H"
@@ -10,11 +12,14 @@
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/DerivedQtyDefs.H"
+#include "amr-wind/utilities/PlotfileWriter.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
+#include "AMReX_AsyncOut.H"
 #include "AMReX_ParmParse.H"
 #include "AMReX_PlotFileUtil.H"
 #include "AMReX_MultiFabUtil.H"
+#include "AMReX_VisMF.H"
 
 namespace amr_wind {
 
@@ -22,7 +27,7 @@ IOManager::IOManager(CFDSim& sim)
     : m_sim(sim), m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
 {}
 
-IOManager::~IOManager() = default;
+IOManager::~IOManager() { wait_for_checkpoint(); }
 
 void IOManager::initialize_io()
 {
@@ -40,6 +45,21 @@ void IOManager::initialize_io()
     pp.query("check_file", m_chk_prefix);
     pp.query("restart_file", m_restart_file);
     pp.query("allow_missing_restart_fields", m_allow_missing_restart_fields);
+    pp.query("async_checkpoint", m_async_checkpoint);
+    pp.query("stream_plot_file", m_stream_plot_file);
+    m_plt_nfiles = amrex::VisMF::GetNOutFiles();
+    pp.query("plot_nfiles", m_plt_nfiles);
+    {
+        std::string precision{"double"};
+        pp.query("plot_precision", precision);
+        if ((precision != "double") && (precision != "float")) {
+            amrex::Abort(
+                "IOManager: Invalid io.plot_precision " + precision +
+                ". Valid options are double or float");
+        }
+        m_plt_single_precision = (precision == "float");
+    }
+    pp.query("plot_compression", m_plt_compression);
 
     // ParmParse requires us to read in a vector
     pp.queryarr("outputs", out_vars);
@@ -47,10 +67,30 @@ void IOManager::initialize_io()
     pp.queryarr("derived_outputs", out_derived_vars);
     pp.queryarr("skip_outputs", out_skip_vars);
 
-    // We process the input vector to eliminate duplicates
-    for (const auto& name : out_vars) {
+    // We process the input vector to eliminate duplicates. Output variables
+    // can specify the absolute error tolerance for compressed plot files
+    // (e.g., velocity:1.0e-4)
+    std::map<std::string, amrex::Real> tolerances;
+    for (const auto& entry : out_vars) {
+        const auto pos = entry.find(':');
+        const auto name = entry.substr(0, pos);
+        if (pos != std::string::npos) {
+            std::istringstream iss(entry.substr(pos + 1));
+            amrex::Real tol = 0.0;
+            if (!(iss >> tol) || !iss.eof() || (tol < 0.0)) {
+                amrex::Abort(
+                    "IOManager: Invalid tolerance in io.outputs entry " +
+                    entry);
+            }
+            tolerances[name] = tol;
+        }
         outputs.insert(name);
     }
+    if (!tolerances.empty() && !m_plt_compression) {
+        amrex::Abort(
+            "IOManager: Tolerances in io.outputs require io.plot_compression "
+            "= true");
+    }
     for (const auto& name : out_skip_vars) {
         skip_outputs.insert(name);
     }
@@ -84,6 +124,12 @@ void IOManager::initialize_io()
             m_plt_num_comp += fld.num_comp();
             m_plt_fields.emplace_back(&fld);
             ioutils::add_var_names(m_plt_var_names, fld.name(), fld.num_comp());
+            if (m_plt_compression) {
+                const auto it = tolerances.find(fname);
+                m_plt_tolerances.resize(
+                    m_plt_num_comp,
+                    (it == tolerances.end()) ? 0.0 : it->second);
+            }
         } else {
             amrex::Print() << "  Invalid output variable requested: " << fname
                            << std::endl;
@@ -108,16 +154,35 @@ void IOManager::initialize_io()
         m_derived_mgr->var_names(m_plt_var_names);
     }
 
+    // Integer fields and derived quantities are compressed losslessly
+    if (m_plt_compression) {
+        m_plt_tolerances.resize(m_plt_num_comp, 0.0);
+    }
+
     for (const auto& fname : m_chkvars) {
         auto& fld = repo.get_field(fname);
         m_chk_fields.emplace_back(&fld);
     }
+
+    if (m_async_checkpoint && !amrex::AsyncOut::UseAsyncOut()) {
+        amrex::Print() << "WARNING: io.async_checkpoint requires "
+                          "amrex.async_out = 1. Checkpoint files will be "
+                          "written synchronously."
+                       << std::endl;
+        m_async_checkpoint = false;
+    }
 }
 
 void IOManager::write_plot_file()
 {
     BL_PROFILE("amr-wind::IOManager::write_plot_file");
 
+    // Compressed plot files are only written by the streaming writer
+    if (m_stream_plot_file || m_plt_compression) {
+        write_plot_file_streaming();
+        return;
+    }
+
     amrex::Vector<int> istep(
         m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
     const int plt_comp = m_plt_num_comp;
@@ -150,13 +215,70 @@ void IOManager::write_plot_file()
     const auto& mesh = m_sim.mesh();
     amrex::Print() << "Writing plot file       " << plt_filename << " at time "
                    << m_sim.time().new_time() << std::endl;
+
+    // VisMF converts the data to the format selected for FArrayBox
+    const auto fab_format = amrex::FArrayBox::getFormat();
+    if (m_plt_single_precision) {
+        amrex::FArrayBox::setFormat(amrex::FABio::FAB_NATIVE_32);
+    }
     amrex::WriteMultiLevelPlotfile(
         plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
         mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio());
+    amrex::FArrayBox::setFormat(fab_format);
 
     write_info_file(plt_filename);
 }
 
+void IOManager::write_plot_file_streaming()
+{
+    BL_PROFILE("amr-wind::IOManager::write_plot_file_streaming");
+
+    amrex::Vector<int> istep(
+        m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
+    const int nlevels = m_sim.repo().num_active_levels();
+    const std::string& plt_filename =
+        amrex::Concatenate(m_plt_prefix, m_sim.time().time_index());
+    amrex::Print() << "Writing plot file       " << plt_filename << " at time "
+                   << m_sim.time().new_time() << std::endl;
+
+    PlotfileWriter writer(
+        m_sim.mesh(), plt_filename, m_plt_var_names, nlevels,
+        m_sim.time().new_time(), istep, m_plt_nfiles, m_plt_single_precision,
+        m_plt_tolerances);
+
+    // Fields are written directly, one box at a time
+    int icomp = 0;
+    for (auto* fld : m_plt_fields) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            writer.write(lev, (*fld)(lev), 0, icomp, fld->num_comp());
+        }
+        icomp += fld->num_comp();
+    }
+
+    for (auto* fld : m_int_plt_fields) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            writer.write(lev, (*fld)(lev), 0, icomp, fld->num_comp());
+        }
+        icomp += fld->num_comp();
+    }
+
+    // Derived quantities are computed one at a time in a scratch field that
+    // is released before the next one is computed
+    for (const auto& qty : m_derived_mgr->derived_quantities()) {
+        const int ncomp = qty->num_comp();
+        auto qfld = m_sim.repo().create_scratch_field(ncomp);
+        (*qty)(*qfld, 0);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            writer.write(lev, (*qfld)(lev), 0, icomp, ncomp);
+        }
+        icomp += ncomp;
+    }
+    AMREX_ALWAYS_ASSERT(icomp == m_plt_num_comp);
+
+    writer.finalize();
+    write_info_file(plt_filename);
+}
+
 void IOManager::write_checkpoint_file(const int start_level)
 {
     BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
@@ -164,6 +286,10 @@ void IOManager::write_checkpoint_file(const int start_level)
     const std::string chkname =
         amrex::Concatenate(m_chk_prefix, m_sim.time().time_index());
 
+    // Only one checkpoint is in flight at any time, which bounds the memory
+    // held by the snapshot buffers
+    wait_for_checkpoint();
+
     amrex::Print() << "Writing checkpoint file " << chkname << " at time "
                    << m_sim.time().new_time() << std::endl;
     const auto& mesh = m_sim.mesh();
@@ -175,12 +301,36 @@ void IOManager::write_checkpoint_file(const int start_level)
     for (int lev = start_level; lev < mesh.finestLevel() + 1; ++lev) {
         for (auto* fld : m_chk_fields) {
             auto& field = *fld;
-            amrex::VisMF::Write(
-                field(lev),
-                amrex::MultiFabFileFullPrefix(
-                    lev - start_level, chkname, level_prefix, field.name()));
+            const auto& fab_file = amrex::MultiFabFileFullPrefix(
+                lev - start_level, chkname, level_prefix, field.name());
+
+            // The asynchronous writer copies the data into host buffers
+            // (snapshot) and the files are written by a background thread
+            if (m_async_checkpoint) {
+                amrex::VisMF::AsyncWrite(field(lev), fab_file);
+            } else {
+                amrex::VisMF::Write(field(lev), fab_file);
+            }
         }
     }
+
+    if (m_async_checkpoint) {
+        m_chk_in_flight = chkname;
+    }
+}
+
+void IOManager::wait_for_checkpoint()
+{
+    if (m_chk_in_flight.empty()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::IOManager::wait_for_checkpoint");
+    amrex::AsyncOut::Finish();
+    amrex::ParallelDescriptor::Barrier();
+    amrex::Print() << "Checkpoint file " << m_chk_in_flight << " complete"
+                   << std::endl;
+    m_chk_in_flight.clear();
 }
 
 void IOManager::read_checkpoint_fields(
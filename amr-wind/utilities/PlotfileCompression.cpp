@@ -0,0 +1,436 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "amr-wind/utilities/PlotfileCompression.H"
+
+#include "AMReX_Geometry.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_PlotFileUtil.H"
+#include "AMReX_Utility.H"
+
+namespace amr_wind {
+namespace plotfile {
+
+namespace {
+
+const std::string index_version{"AMR-Wind-Compressed-FAB-1.0"};
+
+//! Method used to compress a component of a box
+enum class Codec : unsigned char { Lossless = 0, Quantized = 1 };
+
+//! Largest integer multiple of the quantization step that is stored
+constexpr amrex::Real max_quantized = 4503599627370496.0; // 2^52
+
+std::uint64_t to_bits(const amrex::Real val, const bool single)
+{
+    if (single) {
+        const auto fval = static_cast<float>(val);
+        std::uint32_t bits;
+        std::memcpy(&bits, &fval, sizeof(bits));
+        return bits;
+    }
+    const auto dval = static_cast<double>(val);
+    std::uint64_t bits;
+    std::memcpy(&bits, &dval, sizeof(bits));
+    return bits;
+}
+
+amrex::Real from_bits(const std::uint64_t bits, const bool single)
+{
+    if (single) {
+        const auto fbits = static_cast<std::uint32_t>(bits);
+        float fval;
+        std::memcpy(&fval, &fbits, sizeof(fval));
+        return static_cast<amrex::Real>(fval);
+    }
+    double dval;
+    std::memcpy(&dval, &bits, sizeof(dval));
+    return static_cast<amrex::Real>(dval);
+}
+
+//! Map signed integers to unsigned integers with small magnitudes first
+std::uint64_t zigzag(const std::int64_t val)
+{
+    return (static_cast<std::uint64_t>(val) << 1) ^
+           static_cast<std::uint64_t>(val >> 63);
+}
+
+std::int64_t unzigzag(const std::uint64_t val)
+{
+    return static_cast<std::int64_t>(val >> 1) ^
+           -static_cast<std::int64_t>(val & 1);
+}
+
+//! Append an unsigned integer using 7 bits per byte
+void put_varint(std::uint64_t val, std::vector<char>& buf)
+{
+    while (val >= 0x80) {
+        buf.push_back(static_cast<char>((val & 0x7f) | 0x80));
+        val >>= 7;
+    }
+    buf.push_back(static_cast<char>(val));
+}
+
+std::uint64_t get_varint(const unsigned char*& ptr, const unsigned char* end)
+{
+    std::uint64_t val = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (ptr == end) {
+            break;
+        }
+        const auto byte = *ptr++;
+        val |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return val;
+        }
+    }
+    amrex::Abort("plotfile::decode: Corrupt compressed data");
+    return 0;
+}
+
+/** Quantize the values and write the differences between consecutive values
+ *
+ *  Returns false (leaving the buffer untouched) if a value cannot be
+ *  quantized, e.g., if it is not finite.
+ */
+bool encode_quantized(
+    const amrex::Real* vals,
+    const amrex::Long npts,
+    const amrex::Real tol,
+    std::vector<char>& buf)
+{
+    const amrex::Real delta = 2.0 * tol;
+    for (amrex::Long ip = 0; ip < npts; ++ip) {
+        if (!(std::abs(vals[ip] / delta) < max_quantized)) {
+            return false;
+        }
+    }
+
+    buf.push_back(static_cast<char>(Codec::Quantized));
+    std::int64_t prev = 0;
+    for (amrex::Long ip = 0; ip < npts; ++ip) {
+        const auto qval =
+            static_cast<std::int64_t>(std::llround(vals[ip] / delta));
+        put_varint(zigzag(qval - prev), buf);
+        prev = qval;
+    }
+    return true;
+}
+
+/** Write the non-zero bytes of the XOR of consecutive values
+ *
+ *  Every value is preceded by a byte holding the number of leading (upper 4
+ *  bits) and trailing (lower 4 bits) zero bytes that are not written.
+ */
+void encode_lossless(
+    const amrex::Real* vals,
+    const amrex::Long npts,
+    const bool single,
+    std::vector<char>& buf)
+{
+    buf.push_back(static_cast<char>(Codec::Lossless));
+    std::uint64_t prev = 0;
+    for (amrex::Long ip = 0; ip < npts; ++ip) {
+        const auto bits = to_bits(vals[ip], single);
+        const auto xval = bits ^ prev;
+        prev = bits;
+
+        int lead = 0;
+        int trail = 0;
+        if (xval == 0) {
+            lead = 8;
+        } else {
+            while (((xval >> (8 * (7 - lead))) & 0xff) == 0) {
+                ++lead;
+            }
+            while (((xval >> (8 * trail)) & 0xff) == 0) {
+                ++trail;
+            }
+        }
+
+        buf.push_back(static_cast<char>((lead << 4) | trail));
+        for (int ib = trail; ib < 8 - lead; ++ib) {
+            buf.push_back(static_cast<char>((xval >> (8 * ib)) & 0xff));
+        }
+    }
+}
+
+//! Read the compressed index of a level on the IO processor and broadcast it
+CompressedIndex read_index(const std::string& plt_name, const int lev)
+{
+    amrex::Vector<char> buf;
+    amrex::ParallelDescriptor::ReadAndBcastFile(
+        compressed_prefix(plt_name, lev) + "_H", buf);
+    std::istringstream is(buf.dataPtr(), std::istringstream::in);
+
+    CompressedIndex idx;
+    idx.read(is);
+    return idx;
+}
+
+} // namespace
+
+void CompressedIndex::write(std::ostream& os) const
+{
+    const int nboxes = static_cast<int>(ba.size());
+    os << index_version << '\n' << precision << ' ' << ncomp << '\n';
+    os.precision(17);
+    for (const auto tol : tolerances) {
+        os << tol << ' ';
+    }
+    os << '\n';
+    ba.writeOn(os);
+    os << '\n';
+    for (int i = 0; i < nboxes; ++i) {
+        os << file_index[i];
+        for (int n = 0; n < ncomp; ++n) {
+            os << ' ' << offsets[i * ncomp + n] << ' ' << sizes[i * ncomp + n];
+        }
+        os << '\n';
+    }
+}
+
+void CompressedIndex::read(std::istream& is)
+{
+    std::string version;
+    is >> version;
+    if (version != index_version) {
+        amrex::Abort(
+            "plotfile::CompressedIndex: Invalid compressed index version " +
+            version);
+    }
+
+    is >> precision >> ncomp;
+    tolerances.resize(ncomp);
+    for (auto& tol : tolerances) {
+        is >> tol;
+    }
+    ba.readFrom(is);
+
+    const int nboxes = static_cast<int>(ba.size());
+    file_index.resize(nboxes);
+    offsets.resize(nboxes * ncomp);
+    sizes.resize(nboxes * ncomp);
+    for (int i = 0; i < nboxes; ++i) {
+        is >> file_index[i];
+        for (int n = 0; n < ncomp; ++n) {
+            is >> offsets[i * ncomp + n] >> sizes[i * ncomp + n];
+        }
+    }
+
+    if (is.fail()) {
+        amrex::Abort("plotfile::CompressedIndex: Error reading the index");
+    }
+}
+
+std::string compressed_prefix(const std::string& plt_name, const int lev)
+{
+    return amrex::MultiFabFileFullPrefix(lev, plt_name, "Level_", "Cell_Z");
+}
+
+void encode(
+    const amrex::Real* vals,
+    const amrex::Long npts,
+    const amrex::Real tol,
+    const bool single,
+    std::vector<char>& buf)
+{
+    if ((tol > 0.0) && encode_quantized(vals, npts, tol, buf)) {
+        return;
+    }
+    encode_lossless(vals, npts, single, buf);
+}
+
+void decode(
+    const char* data,
+    const amrex::Long nbytes,
+    const amrex::Long npts,
+    const amrex::Real tol,
+    const bool single,
+    amrex::Real* vals)
+{
+    const auto* ptr = reinterpret_cast<const unsigned char*>(data);
+    const auto* end = ptr + nbytes;
+    if (nbytes < 1) {
+        amrex::Abort("plotfile::decode: Corrupt compressed data");
+    }
+
+    const auto codec = static_cast<Codec>(*ptr++);
+    if (codec == Codec::Quantized) {
+        const amrex::Real delta = 2.0 * tol;
+        std::int64_t qval = 0;
+        for (amrex::Long ip = 0; ip < npts; ++ip) {
+            qval += unzigzag(get_varint(ptr, end));
+            vals[ip] = static_cast<amrex::Real>(qval) * delta;
+        }
+    } else if (codec == Codec::Lossless) {
+        std::uint64_t prev = 0;
+        for (amrex::Long ip = 0; ip < npts; ++ip) {
+            if (ptr == end) {
+                amrex::Abort("plotfile::decode: Corrupt compressed data");
+            }
+            const int lead = *ptr >> 4;
+            const int trail = *ptr & 0x0f;
+            ++ptr;
+            if ((lead + trail > 8) || (end - ptr < 8 - lead - trail)) {
+                amrex::Abort("plotfile::decode: Corrupt compressed data");
+            }
+
+            std::uint64_t xval = 0;
+            for (int ib = trail; ib < 8 - lead; ++ib) {
+                xval |= static_cast<std::uint64_t>(*ptr++) << (8 * ib);
+            }
+            prev ^= xval;
+            vals[ip] = from_bits(prev, single);
+        }
+    } else {
+        amrex::Abort("plotfile::decode: Unknown compression method");
+    }
+}
+
+void read_compressed_level(
+    const std::string& plt_name, const int lev, amrex::MultiFab& mf)
+{
+    BL_PROFILE("amr-wind::plotfile::read_compressed_level");
+    const auto idx = read_index(plt_name, lev);
+    const bool single = (idx.precision == 32);
+    const std::string prefix = compressed_prefix(plt_name, lev) + "_D_";
+
+    const amrex::DistributionMapping dm(idx.ba);
+    mf.define(idx.ba, dm, idx.ncomp, 0);
+
+    std::ifstream ifs;
+    int open_file = -1;
+    std::vector<char> chunk;
+    std::vector<amrex::Real> vals;
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const int i = mfi.index();
+        const auto npts = mfi.validbox().numPts();
+
+        if (idx.file_index[i] != open_file) {
+            const std::string fname =
+                amrex::Concatenate(prefix, idx.file_index[i], 5);
+            ifs.close();
+            ifs.open(fname.c_str(), std::ifstream::in | std::ifstream::binary);
+            if (!ifs.good()) {
+                amrex::FileOpenFailed(fname);
+            }
+            open_file = idx.file_index[i];
+        }
+
+        vals.resize(npts);
+        for (int n = 0; n < idx.ncomp; ++n) {
+            const auto nbytes = idx.sizes[i * idx.ncomp + n];
+            chunk.resize(nbytes);
+            ifs.seekg(idx.offsets[i * idx.ncomp + n]);
+            ifs.read(chunk.data(), static_cast<std::streamsize>(nbytes));
+            if (!ifs.good()) {
+                amrex::Abort(
+                    "plotfile::read_compressed_level: Error reading " +
+                    plt_name);
+            }
+
+            decode(
+                chunk.data(), nbytes, npts, idx.tolerances[n], single,
+                vals.data());
+            amrex::Gpu::htod_memcpy(
+                mf[mfi].dataPtr(n), vals.data(), npts * sizeof(amrex::Real));
+        }
+    }
+}
+
+bool is_compressed(const std::string& plt_name)
+{
+    return amrex::FileExists(compressed_prefix(plt_name, 0) + "_H");
+}
+
+void decompress(const std::string& plt_name, const std::string& out_name)
+{
+    BL_PROFILE("amr-wind::plotfile::decompress");
+
+    // Geometry and variables from the plotfile header
+    amrex::Vector<char> buf;
+    amrex::ParallelDescriptor::ReadAndBcastFile(plt_name + "/Header", buf);
+    std::istringstream is(buf.dataPtr(), std::istringstream::in);
+
+    std::string version;
+    int ncomp = 0;
+    is >> version >> ncomp;
+    amrex::Vector<std::string> var_names(ncomp);
+    for (auto& name : var_names) {
+        is >> name;
+    }
+
+    int spacedim = 0;
+    amrex::Real time = 0.0;
+    int finest_level = 0;
+    is >> spacedim >> time >> finest_level;
+    if (spacedim != AMREX_SPACEDIM) {
+        amrex::Abort("plotfile::decompress: Invalid header in " + plt_name);
+    }
+    const int nlevels = finest_level + 1;
+
+    amrex::Array<amrex::Real, AMREX_SPACEDIM> prob_lo{{0.0}};
+    amrex::Array<amrex::Real, AMREX_SPACEDIM> prob_hi{{0.0}};
+    for (auto& plo : prob_lo) {
+        is >> plo;
+    }
+    for (auto& phi : prob_hi) {
+        is >> phi;
+    }
+
+    amrex::Vector<amrex::IntVect> ref_ratio(finest_level);
+    for (auto& rr : ref_ratio) {
+        int ratio = 0;
+        is >> ratio;
+        rr = amrex::IntVect(ratio);
+    }
+
+    amrex::Vector<amrex::Box> domains(nlevels);
+    for (auto& domain : domains) {
+        is >> domain;
+    }
+
+    amrex::Vector<int> istep(nlevels);
+    for (auto& step : istep) {
+        is >> step;
+    }
+
+    // Cell sizes are recomputed from the domains
+    for (int i = 0; i < nlevels * AMREX_SPACEDIM; ++i) {
+        amrex::Real dx;
+        is >> dx;
+    }
+
+    int coord = 0;
+    is >> coord;
+    if (is.fail()) {
+        amrex::Abort("plotfile::decompress: Error reading " + plt_name);
+    }
+
+    const amrex::RealBox rb(prob_lo, prob_hi);
+    const amrex::Array<int, AMREX_SPACEDIM> is_periodic{
+        AMREX_D_DECL(0, 0, 0)};
+    amrex::Vector<amrex::Geometry> geom(nlevels);
+    amrex::Vector<amrex::MultiFab> data(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        geom[lev].define(domains[lev], rb, coord, is_periodic);
+        read_compressed_level(plt_name, lev, data[lev]);
+    }
+
+    // Write the data in the precision of the compressed plotfile
+    const auto fab_format = amrex::FArrayBox::getFormat();
+    if (read_index(plt_name, 0).precision == 32) {
+        amrex::FArrayBox::setFormat(amrex::FABio::FAB_NATIVE_32);
+    }
+    amrex::WriteMultiLevelPlotfile(
+        out_name, nlevels, amrex::GetVecOfConstPtrs(data), var_names, geom,
+        time, istep, ref_ratio);
+    amrex::FArrayBox::setFormat(fab_format);
+}
+
+} // namespace plotfile
+} // namespace amr_wind
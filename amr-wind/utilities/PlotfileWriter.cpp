@@ -0,0 +1,504 @@
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "amr-wind/utilities/PlotfileWriter.H"
+#include "amr-wind/utilities/PlotfileCompression.H"
+
+#include "AMReX_FPC.H"
+#include "AMReX_FabConv.H"
+#include "AMReX_PlotFileUtil.H"
+#include "AMReX_VisMF.H"
+
+namespace amr_wind {
+
+namespace {
+
+const std::string level_prefix{"Level_"};
+const std::string mf_prefix{"Cell"};
+
+//! Copy the valid cells of a box into the host staging buffer
+template <typename T>
+void stage_box(
+    const amrex::Box& bx,
+    const amrex::Array4<const T>& src,
+    const int ncomp,
+    amrex::FArrayBox& stage)
+{
+    const auto& dst = stage.array();
+    amrex::ParallelFor(
+        bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+            dst(i, j, k, n) = static_cast<amrex::Real>(src(i, j, k, n));
+        });
+    amrex::Gpu::streamSynchronize();
+}
+
+//! Index of the data file written by an MPI rank
+int file_number(const int rank, const int nprocs, const int nfiles)
+{
+    return static_cast<int>(
+        (static_cast<amrex::Long>(rank) * nfiles) / nprocs);
+}
+
+//! Name of a compressed data file of a level
+std::string compressed_data_file(
+    const std::string& plt_name, const int lev, const int ifile)
+{
+    return amrex::Concatenate(
+        plotfile::compressed_prefix(plt_name, lev) + "_D_", ifile, 5);
+}
+
+} // namespace
+
+PlotfileWriter::PlotfileWriter(
+    const amrex::AmrCore& mesh,
+    std::string plt_name,
+    const amrex::Vector<std::string>& var_names,
+    const int nlevels,
+    const amrex::Real time,
+    const amrex::Vector<int>& istep,
+    const int nfiles,
+    const bool single_precision,
+    amrex::Vector<amrex::Real> tolerances)
+    : m_mesh(mesh)
+    , m_name(std::move(plt_name))
+    , m_files(nlevels)
+    , m_offsets(nlevels)
+    , m_data_offsets(nlevels)
+    , m_file_index(nlevels)
+    , m_min(nlevels)
+    , m_max(nlevels)
+    , m_tolerances(std::move(tolerances))
+    , m_chunk_offsets(nlevels)
+    , m_chunk_sizes(nlevels)
+    , m_file_end(nlevels, 0)
+    , m_ncomp(static_cast<int>(var_names.size()))
+    , m_nlevels(nlevels)
+    , m_nfiles(amrex::max(
+          1, amrex::min(nfiles, amrex::ParallelDescriptor::NProcs())))
+    , m_value_size(single_precision ? sizeof(float) : sizeof(amrex::Real))
+    , m_single(single_precision)
+    , m_compressed(!m_tolerances.empty())
+{
+    BL_PROFILE("amr-wind::PlotfileWriter::PlotfileWriter");
+    AMREX_ALWAYS_ASSERT(
+        !m_compressed || (static_cast<int>(m_tolerances.size()) == m_ncomp));
+    amrex::PreBuildDirectorHierarchy(m_name, level_prefix, m_nlevels, true);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const std::string hdr_name = m_name + "/Header";
+        std::ofstream hdr(
+            hdr_name.c_str(),
+            std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+        if (!hdr.good()) {
+            amrex::FileOpenFailed(hdr_name);
+        }
+        hdr.precision(17);
+        amrex::WriteGenericPlotfileHeader(
+            hdr, m_nlevels, m_mesh.boxArray(), var_names, m_mesh.Geom(), time,
+            istep, m_mesh.refRatio());
+    }
+
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        const auto nboxes = m_mesh.boxArray(lev).size();
+        m_offsets[lev].assign(nboxes, 0);
+        m_data_offsets[lev].assign(nboxes, 0);
+        m_file_index[lev].assign(nboxes, 0);
+        m_min[lev].assign(nboxes * m_ncomp, 0.0);
+        m_max[lev].assign(nboxes * m_ncomp, 0.0);
+        if (m_compressed) {
+            m_chunk_offsets[lev].assign(nboxes * m_ncomp, 0);
+            m_chunk_sizes[lev].assign(nboxes * m_ncomp, 0);
+        }
+    }
+
+    if (m_compressed) {
+        create_compressed_data_files();
+    } else {
+        create_data_files();
+    }
+}
+
+PlotfileWriter::~PlotfileWriter() = default;
+
+std::string PlotfileWriter::fab_header(const amrex::Box& bx) const
+{
+    // Same as the header written by FABio_binary for the native formats
+    std::ostringstream os;
+    os << "FAB "
+       << (m_single ? amrex::FPC::Native32RealDescriptor()
+                    : amrex::FPC::NativeRealDescriptor())
+       << bx << ' ' << m_ncomp << '\n';
+    return os.str();
+}
+
+void PlotfileWriter::create_data_files()
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    const int ifile = file_number(myproc, nprocs, m_nfiles);
+
+    // Number of bytes written by every rank at every level
+    amrex::Vector<amrex::Long> nbytes(m_nlevels * nprocs, 0);
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        for (amrex::MFIter mfi(
+                 m_mesh.boxArray(lev), m_mesh.DistributionMap(lev));
+             mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            nbytes[lev * nprocs + myproc] +=
+                static_cast<amrex::Long>(fab_header(bx).size()) +
+                bx.numPts() * m_ncomp * m_value_size;
+        }
+    }
+    amrex::ParallelDescriptor::ReduceLongSum(
+        nbytes.data(), static_cast<int>(nbytes.size()));
+
+    // The ranks sharing a data file write to contiguous regions ordered by
+    // rank. The first rank of each group creates the file.
+    amrex::Vector<amrex::Long> rank_offset(m_nlevels, 0);
+    amrex::Vector<std::string> fnames(m_nlevels);
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        fnames[lev] = amrex::Concatenate(
+            amrex::MultiFabFileFullPrefix(
+                lev, m_name, level_prefix, mf_prefix) +
+                "_D_",
+            ifile, 5);
+
+        amrex::Long total = 0;
+        bool is_first = true;
+        for (int ip = 0; ip < nprocs; ++ip) {
+            if (file_number(ip, nprocs, m_nfiles) != ifile) {
+                continue;
+            }
+            if (ip < myproc) {
+                rank_offset[lev] += nbytes[lev * nprocs + ip];
+                is_first = false;
+            }
+            total += nbytes[lev * nprocs + ip];
+        }
+
+        if (is_first && (total > 0)) {
+            std::ofstream ofs(
+                fnames[lev].c_str(), std::ofstream::out |
+                                         std::ofstream::trunc |
+                                         std::ofstream::binary);
+            if (!ofs.good()) {
+                amrex::FileOpenFailed(fnames[lev]);
+            }
+        }
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        if (nbytes[lev * nprocs + myproc] < 1) {
+            continue;
+        }
+
+        auto& file = m_files[lev];
+        file.open(
+            fnames[lev].c_str(),
+            std::fstream::in | std::fstream::out | std::fstream::binary);
+        if (!file.is_open()) {
+            amrex::FileOpenFailed(fnames[lev]);
+        }
+
+        amrex::Long offset = rank_offset[lev];
+        for (amrex::MFIter mfi(
+                 m_mesh.boxArray(lev), m_mesh.DistributionMap(lev));
+             mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            const int idx = mfi.index();
+            const auto hdr = fab_header(bx);
+
+            m_offsets[lev][idx] = offset;
+            m_data_offsets[lev][idx] =
+                offset + static_cast<amrex::Long>(hdr.size());
+            m_file_index[lev][idx] = ifile;
+
+            file.seekp(offset);
+            file.write(hdr.data(), static_cast<std::streamsize>(hdr.size()));
+            offset =
+                m_data_offsets[lev][idx] + bx.numPts() * m_ncomp * m_value_size;
+        }
+    }
+}
+
+void PlotfileWriter::create_compressed_data_files()
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    const int ifile = file_number(myproc, nprocs, m_nfiles);
+
+    // The size of the compressed data is not known in advance, so the data
+    // is appended to the files as it is written. The first rank of each
+    // group creates the file.
+    const bool is_first =
+        (myproc == 0) || (file_number(myproc - 1, nprocs, m_nfiles) != ifile);
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        for (amrex::MFIter mfi(
+                 m_mesh.boxArray(lev), m_mesh.DistributionMap(lev));
+             mfi.isValid(); ++mfi) {
+            m_file_index[lev][mfi.index()] = ifile;
+        }
+
+        if (is_first) {
+            const auto fname = compressed_data_file(m_name, lev, ifile);
+            std::ofstream ofs(
+                fname.c_str(), std::ofstream::out | std::ofstream::trunc |
+                                   std::ofstream::binary);
+            if (!ofs.good()) {
+                amrex::FileOpenFailed(fname);
+            }
+        }
+    }
+    amrex::ParallelDescriptor::Barrier();
+}
+
+amrex::Long
+PlotfileWriter::write_compressed(const int lev, const std::vector<char>& buf)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    const int ifile = file_number(myproc, nprocs, m_nfiles);
+
+    amrex::Vector<amrex::Long> nbytes(nprocs, 0);
+    nbytes[myproc] = static_cast<amrex::Long>(buf.size());
+    amrex::ParallelDescriptor::ReduceLongSum(nbytes.data(), nprocs);
+
+    // The ranks sharing a data file append their data ordered by rank
+    amrex::Long offset = m_file_end[lev];
+    for (int ip = 0; ip < nprocs; ++ip) {
+        if (file_number(ip, nprocs, m_nfiles) != ifile) {
+            continue;
+        }
+        if (ip < myproc) {
+            offset += nbytes[ip];
+        }
+        m_file_end[lev] += nbytes[ip];
+    }
+    if (buf.empty()) {
+        return offset;
+    }
+
+    auto& file = m_files[lev];
+    if (!file.is_open()) {
+        const auto fname = compressed_data_file(m_name, lev, ifile);
+        file.open(
+            fname.c_str(),
+            std::fstream::in | std::fstream::out | std::fstream::binary);
+        if (!file.is_open()) {
+            amrex::FileOpenFailed(fname);
+        }
+    }
+    file.seekp(offset);
+    file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    if (!file.good()) {
+        amrex::Abort("PlotfileWriter: Error writing " + m_name);
+    }
+    return offset;
+}
+
+template <typename MFType>
+void PlotfileWriter::write_group(
+    const int lev,
+    const MFType& mf,
+    const int srccomp,
+    const int dstcomp,
+    const int ncomp)
+{
+    BL_PROFILE("amr-wind::PlotfileWriter::write");
+    AMREX_ALWAYS_ASSERT(!m_finalized);
+    AMREX_ALWAYS_ASSERT((dstcomp + ncomp) <= m_ncomp);
+    AMREX_ALWAYS_ASSERT(mf.boxArray() == m_mesh.boxArray(lev));
+    if (ncomp < 1) {
+        return;
+    }
+
+    auto& file = m_files[lev];
+    std::vector<char> cbuf;
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const int idx = mfi.index();
+        const auto npts = bx.numPts();
+
+        amrex::FArrayBox stage(bx, ncomp, amrex::The_Pinned_Arena());
+        stage_box(bx, mf.const_array(mfi, srccomp), ncomp, stage);
+
+        for (int n = 0; n < ncomp; ++n) {
+            auto* ptr = stage.dataPtr(n);
+            if (m_single) {
+                for (amrex::Long ip = 0; ip < npts; ++ip) {
+                    ptr[ip] = static_cast<float>(ptr[ip]);
+                }
+            }
+
+            const auto minmax = std::minmax_element(ptr, ptr + npts);
+            m_min[lev][idx * m_ncomp + dstcomp + n] = *minmax.first;
+            m_max[lev][idx * m_ncomp + dstcomp + n] = *minmax.second;
+
+            if (m_compressed) {
+                const auto ichunk = idx * m_ncomp + dstcomp + n;
+                const auto start = static_cast<amrex::Long>(cbuf.size());
+                plotfile::encode(
+                    ptr, npts, m_tolerances[dstcomp + n], m_single, cbuf);
+                m_chunk_offsets[lev][ichunk] = start;
+                m_chunk_sizes[lev][ichunk] =
+                    static_cast<amrex::Long>(cbuf.size()) - start;
+            }
+        }
+        if (m_compressed) {
+            continue;
+        }
+
+        const amrex::Long nvals = ncomp * npts;
+        file.seekp(m_data_offsets[lev][idx] + dstcomp * npts * m_value_size);
+        if (m_single) {
+            std::vector<float> buf(stage.dataPtr(), stage.dataPtr() + nvals);
+            file.write(
+                reinterpret_cast<const char*>(buf.data()),
+                static_cast<std::streamsize>(nvals * m_value_size));
+        } else {
+            file.write(
+                reinterpret_cast<const char*>(stage.dataPtr()),
+                static_cast<std::streamsize>(nvals * m_value_size));
+        }
+        if (!file.good()) {
+            amrex::Abort("PlotfileWriter: Error writing " + m_name);
+        }
+    }
+
+    if (m_compressed) {
+        // Convert the offsets within the buffer to offsets within the file
+        const auto offset = write_compressed(lev, cbuf);
+        for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            for (int n = 0; n < ncomp; ++n) {
+                m_chunk_offsets[lev][mfi.index() * m_ncomp + dstcomp + n] +=
+                    offset;
+            }
+        }
+    }
+}
+
+void PlotfileWriter::write(
+    const int lev,
+    const amrex::MultiFab& mf,
+    const int srccomp,
+    const int dstcomp,
+    const int ncomp)
+{
+    write_group(lev, mf, srccomp, dstcomp, ncomp);
+}
+
+void PlotfileWriter::write(
+    const int lev,
+    const amrex::iMultiFab& mf,
+    const int srccomp,
+    const int dstcomp,
+    const int ncomp)
+{
+    write_group(lev, mf, srccomp, dstcomp, ncomp);
+}
+
+void PlotfileWriter::write_level_header(const int lev)
+{
+    const auto& ba = m_mesh.boxArray(lev);
+    const int nboxes = static_cast<int>(ba.size());
+
+    amrex::VisMF::Header hdr;
+    hdr.m_vers = amrex::VisMF::Header::Version_v1;
+    hdr.m_how = amrex::VisMF::NFiles;
+    hdr.m_ncomp = m_ncomp;
+    hdr.m_ngrow = amrex::IntVect(0);
+    hdr.m_ba = ba;
+    hdr.m_fod.resize(nboxes);
+    hdr.m_min.resize(nboxes);
+    hdr.m_max.resize(nboxes);
+    for (int i = 0; i < nboxes; ++i) {
+        hdr.m_fod[i] = amrex::VisMF::FabOnDisk(
+            amrex::Concatenate(mf_prefix + "_D_", m_file_index[lev][i], 5),
+            m_offsets[lev][i]);
+        const auto begin = i * m_ncomp;
+        hdr.m_min[i].assign(
+            m_min[lev].begin() + begin, m_min[lev].begin() + begin + m_ncomp);
+        hdr.m_max[i].assign(
+            m_max[lev].begin() + begin, m_max[lev].begin() + begin + m_ncomp);
+    }
+
+    const std::string hdr_name =
+        amrex::MultiFabFileFullPrefix(lev, m_name, level_prefix, mf_prefix) +
+        "_H";
+    std::ofstream ofs(
+        hdr_name.c_str(), std::ofstream::out | std::ofstream::trunc);
+    if (!ofs.good()) {
+        amrex::FileOpenFailed(hdr_name);
+    }
+    ofs << hdr;
+}
+
+void PlotfileWriter::write_compressed_index(const int lev)
+{
+    plotfile::CompressedIndex idx;
+    idx.precision = m_single ? 32 : 64;
+    idx.ncomp = m_ncomp;
+    idx.tolerances = m_tolerances;
+    idx.ba = m_mesh.boxArray(lev);
+    idx.file_index = m_file_index[lev];
+    idx.offsets = m_chunk_offsets[lev];
+    idx.sizes = m_chunk_sizes[lev];
+
+    const std::string idx_name =
+        plotfile::compressed_prefix(m_name, lev) + "_H";
+    std::ofstream ofs(
+        idx_name.c_str(), std::ofstream::out | std::ofstream::trunc);
+    if (!ofs.good()) {
+        amrex::FileOpenFailed(idx_name);
+    }
+    idx.write(ofs);
+}
+
+void PlotfileWriter::finalize()
+{
+    BL_PROFILE("amr-wind::PlotfileWriter::finalize");
+    if (m_finalized) {
+        return;
+    }
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        if (m_files[lev].is_open()) {
+            m_files[lev].close();
+        }
+
+        // Every box is owned by a single rank, the others contribute zeros
+        amrex::ParallelDescriptor::ReduceLongSum(
+            m_offsets[lev].data(), static_cast<int>(m_offsets[lev].size()),
+            ioproc);
+        amrex::ParallelDescriptor::ReduceIntSum(
+            m_file_index[lev].data(),
+            static_cast<int>(m_file_index[lev].size()), ioproc);
+        amrex::ParallelDescriptor::ReduceRealSum(
+            m_min[lev].data(), static_cast<int>(m_min[lev].size()), ioproc);
+        amrex::ParallelDescriptor::ReduceRealSum(
+            m_max[lev].data(), static_cast<int>(m_max[lev].size()), ioproc);
+
+        if (m_compressed) {
+            amrex::ParallelDescriptor::ReduceLongSum(
+                m_chunk_offsets[lev].data(),
+                static_cast<int>(m_chunk_offsets[lev].size()), ioproc);
+            amrex::ParallelDescriptor::ReduceLongSum(
+                m_chunk_sizes[lev].data(),
+                static_cast<int>(m_chunk_sizes[lev].size()), ioproc);
+        }
+
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            if (m_compressed) {
+                write_compressed_index(lev);
+            } else {
+                write_level_header(lev);
+            }
+        }
+    }
+    m_finalized = true;
+}
+
+} // namespace amr_wind
@@ -1,6 +1,7 @@
 #include "amr-wind/utilities/sampling/FreeSurface.H"
 #include "amr-wind/utilities/io_utils.H"
 #include <AMReX_MultiFabUtil.H>
+#include <cmath>
 #include <utility>
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
@@ -9,6 +10,127 @@
 namespace amr_wind {
 namespace free_surface {
 
+namespace {
+
+/** Find the cell that contains a 2D grid point along one direction
+ *
+ *  A point lying on a cell face is assigned to the cell below it, except on
+ *  the lo boundary of the domain, to avoid double-counting.
+ *
+ *  \param loc Coordinate of the grid point
+ *  \param plo Lo coordinate of the domain
+ *  \param dx Cell size
+ *  \param idx Index of the containing cell
+ *  \return True if a containing cell was found
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE bool containing_cell(
+    const amrex::Real loc,
+    const amrex::Real plo,
+    const amrex::Real dx,
+    int& idx)
+{
+    const int i0 = static_cast<int>(amrex::Math::ceil((loc - plo) / dx)) - 1;
+    for (int i = i0 - 1; i <= i0 + 1; ++i) {
+        const amrex::Real xm = plo + (i + 0.5) * dx;
+        if ((plo == loc && xm - loc == 0.5 * dx) ||
+            (xm - loc < 0.5 * dx && loc - xm <= 0.5 * dx)) {
+            idx = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Height of the vof = 0.5 isosurface at a 2D grid point within a cell
+ *
+ *  The volume fractions are interpolated in x and y to the grid point for the
+ *  cell and the ones above and below it, and the isosurface location is then
+ *  interpolated in z. Returns plo[2] if the cell does not contain the
+ *  interface.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real interface_height(
+    const int i,
+    const int j,
+    const int k,
+    const amrex::GpuArray<amrex::Real, 2>& loc,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& plo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxi,
+    const amrex::Array4<amrex::Real const>& vof_arr)
+{
+    amrex::Real ht = plo[2];
+
+    // Check if cell is obviously multiphase, then check if cell might have
+    // interface at top or bottom
+    if (!((vof_arr(i, j, k) < (1.0 - 1e-12) && vof_arr(i, j, k) > 1e-12) ||
+          (vof_arr(i, j, k) < 1e-12 &&
+           (vof_arr(i, j, k + 1) > (1.0 - 1e-12) ||
+            vof_arr(i, j, k - 1) > (1.0 - 1e-12))))) {
+        return ht;
+    }
+
+    // Cell location
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
+    xm[0] = plo[0] + (i + 0.5) * dx[0];
+    xm[1] = plo[1] + (j + 0.5) * dx[1];
+    xm[2] = plo[2] + (k + 0.5) * dx[2];
+
+    // Determine which cells to use for x, y
+    amrex::Real wx_hi;
+    amrex::Real wy_hi;
+    int iup, idn, jup, jdn;
+    if (loc[0] < xm[0]) {
+        iup = i;
+        idn = i - 1;
+        wx_hi = (loc[0] - (xm[0] - dx[0])) * dxi[0];
+    } else {
+        iup = i + 1;
+        idn = i;
+        wx_hi = (loc[0] - xm[0]) * dxi[0];
+    }
+    if (loc[1] < xm[1]) {
+        jup = j;
+        jdn = j - 1;
+        wy_hi = (loc[1] - (xm[1] - dx[1])) * dxi[1];
+    } else {
+        jup = j + 1;
+        jdn = j;
+        wy_hi = (loc[1] - xm[1]) * dxi[1];
+    }
+    const amrex::Real wx_lo = 1.0 - wx_hi;
+    const amrex::Real wy_lo = 1.0 - wy_hi;
+
+    // Interpolate in x and y for the current cell and the ones above and below
+    const amrex::Real vof_above = wx_lo * wy_lo * vof_arr(idn, jdn, k + 1) +
+                                  wx_lo * wy_hi * vof_arr(idn, jup, k + 1) +
+                                  wx_hi * wy_lo * vof_arr(iup, jdn, k + 1) +
+                                  wx_hi * wy_hi * vof_arr(iup, jup, k + 1);
+    const amrex::Real vof_here = wx_lo * wy_lo * vof_arr(idn, jdn, k) +
+                                 wx_lo * wy_hi * vof_arr(idn, jup, k) +
+                                 wx_hi * wy_lo * vof_arr(iup, jdn, k) +
+                                 wx_hi * wy_hi * vof_arr(iup, jup, k);
+    const amrex::Real vof_below = wx_lo * wy_lo * vof_arr(idn, jdn, k - 1) +
+                                  wx_lo * wy_hi * vof_arr(idn, jup, k - 1) +
+                                  wx_hi * wy_lo * vof_arr(iup, jdn, k - 1) +
+                                  wx_hi * wy_hi * vof_arr(iup, jup, k - 1);
+
+    // Determine which cell to interpolate with
+    const bool above = (vof_above - 0.5) * (vof_here - 0.5) <= 0.0;
+    const bool below = (vof_below - 0.5) * (vof_here - 0.5) <= 0.0;
+    if (above) {
+        // Interpolate positive direction
+        ht = xm[2] + (dx[2]) / (vof_above - vof_here) * (0.5 - vof_here);
+    } else if (below) {
+        // Interpolate negative direction
+        ht = xm[2] - (dx[2]) / (vof_below - vof_here) * (0.5 - vof_here);
+    }
+    // If none satisfy requirement, then the isosurface vof = 0.5 cannot be
+    // detected in the z-direction
+    return ht;
+}
+
+} // namespace
+
 FreeSurface::FreeSurface(CFDSim& sim, std::string label)
     : m_sim(sim), m_label(std::move(label)), m_vof(sim.repo().get_field("vof"))
 {
@@ -84,211 +206,149 @@ void FreeSurface::post_advance_work()
         return;
     }
 
-    // Zero data in output array
-    for (int n = 0; n < m_npts * m_ninst; n++) {
-        m_out[n] = 0.0;
+    const auto& mesh = m_sim.mesh();
+    const int finest_level = m_vof.repo().num_active_levels() - 1;
+
+    // Use level_mask to identify smallest volume, shared by all instances
+    amrex::Vector<amrex::iMultiFab> level_mask(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; lev++) {
+        if (lev < finest_level) {
+            level_mask[lev] = makeFineMask(
+                mesh.boxArray(lev), mesh.DistributionMap(lev),
+                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
+        } else {
+            level_mask[lev].define(
+                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
+                amrex::MFInfo());
+            level_mask[lev].setVal(1);
+        }
+    }
+
+    // Grid point locations on device
+    amrex::Gpu::DeviceVector<amrex::Real> dlocs(2 * m_npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, &m_locs[0][0], &m_locs[0][0] + 2 * m_npts,
+        dlocs.begin());
+    const auto* dlocs_ptr = dlocs.data();
+
+    // Spacing of the 2D grid, used to find the points covered by a box
+    amrex::Array<amrex::Real, 2> gdx;
+    for (int nd = 0; nd < 2; ++nd) {
+        const int d = m_griddim[nd];
+        gdx[nd] = (m_end[d] - m_start[d]) / amrex::max(m_npts_dir[nd] - 1, 1);
     }
-    // Set up device vector of outputs, initialize to above phi0
-    const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
-    const auto& phi0 = m_sim.mesh().Geom(0).ProbHiArray();
-    amrex::Gpu::DeviceVector<double> dout(m_npts, phi0[2] + 1.0);
-    auto* dout_ptr = dout.data();
 
-    // Sum of interface locations at each point (assumes one interface only)
-    const int finest_level = m_vof.repo().num_active_levels() - 1;
+    // Set up device vector of outputs, initialize to above phi0
+    const auto& plo0 = mesh.Geom(0).ProbLoArray();
+    const auto& phi0 = mesh.Geom(0).ProbHiArray();
+    amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, phi0[2] + 1.0);
+    amrex::Gpu::DeviceVector<amrex::Real> dheight(m_npts);
+    const auto* dout_ptr = dout.data();
+    auto* dheight_ptr = dheight.data();
+    const int npx = m_npts_dir[0];
 
     // Loop instances
     for (int ni = 0; ni < m_ninst; ++ni) {
-        for (int lev = 0; lev <= finest_level; lev++) {
-
-            // Use level_mask to identify smallest volume
-            amrex::iMultiFab level_mask;
-            if (lev < finest_level) {
-                level_mask = makeFineMask(
-                    m_sim.mesh().boxArray(lev),
-                    m_sim.mesh().DistributionMap(lev),
-                    m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-            } else {
-                level_mask.define(
-                    m_sim.mesh().boxArray(lev),
-                    m_sim.mesh().DistributionMap(lev), 1, 0, amrex::MFInfo());
-                level_mask.setVal(1);
-            }
+        // Height above problo of the interface at each point on this rank
+        amrex::Gpu::fillAsync(dheight.begin(), dheight.end(), 0.0);
 
+        for (int lev = 0; lev <= finest_level; lev++) {
             const auto& vof = m_vof(lev);
-            const auto& geom = m_sim.mesh().Geom(lev);
-            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
-                geom.CellSizeArray();
-            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dxi =
-                geom.InvCellSizeArray();
-            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
-                geom.ProbLoArray();
-
-            // Loop points in 2D grid
-            for (int n = 0; n < m_npts; ++n) {
-                amrex::GpuArray<amrex::Real, 2> loc;
-                for (int d = 0; d < 2; ++d) {
-                    loc[d] = m_locs[n][d];
+            const auto& geom = mesh.Geom(lev);
+            const auto dx = geom.CellSizeArray();
+            const auto dxi = geom.InvCellSizeArray();
+            const auto plo = geom.ProbLoArray();
+
+            // Each box is visited once and only the columns that contain 2D
+            // grid points are searched for the interface
+            for (amrex::MFIter mfi(vof); mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.validbox();
+                const auto lo = amrex::lbound(bx);
+                const auto hi = amrex::ubound(bx);
+
+                amrex::Array<int, 2> pt_lo;
+                amrex::Array<int, 2> pt_hi;
+                for (int nd = 0; nd < 2; ++nd) {
+                    const int d = m_griddim[nd];
+                    pt_lo[nd] = 0;
+                    pt_hi[nd] = m_npts_dir[nd] - 1;
+                    if ((m_npts_dir[nd] > 1) && (gdx[nd] > 0.0)) {
+                        const amrex::Real xlo =
+                            plo[d] + bx.smallEnd(d) * dx[d] - m_start[d];
+                        const amrex::Real xhi =
+                            plo[d] + (bx.bigEnd(d) + 1) * dx[d] - m_start[d];
+                        pt_lo[nd] = amrex::max(
+                            pt_lo[nd],
+                            static_cast<int>(std::floor(xlo / gdx[nd])) - 1);
+                        pt_hi[nd] = amrex::min(
+                            pt_hi[nd],
+                            static_cast<int>(std::ceil(xhi / gdx[nd])) + 1);
+                    }
+                }
+                if ((pt_lo[0] > pt_hi[0]) || (pt_lo[1] > pt_hi[1])) {
+                    continue;
                 }
 
-                m_out[ni * m_npts + n] = amrex::max(
-                    m_out[ni * m_npts + n],
-                    amrex::ReduceMax(
-                        vof, level_mask, 0,
-                        [=] AMREX_GPU_HOST_DEVICE(
-                            amrex::Box const& bx,
-                            amrex::Array4<amrex::Real const> const& vof_arr,
-                            amrex::Array4<int const> const& mask_arr)
-                            -> amrex::Real {
-                            amrex::Real height_fab = 0.0;
-
-                            amrex::Loop(
-                                bx,
-                                [=, &height_fab](int i, int j, int k) noexcept {
-                                    // Initialize height measurement
-                                    amrex::Real ht = plo[2];
-                                    // Cell location
-                                    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>
-                                        xm;
-                                    xm[0] = plo[0] + (i + 0.5) * dx[0];
-                                    xm[1] = plo[1] + (j + 0.5) * dx[1];
-                                    xm[2] = plo[2] + (k + 0.5) * dx[2];
-                                    // (1) Check that cell height is below
-                                    // previous instance. (2) Check if cell
-                                    // contains 2D grid point: complicated
-                                    // conditional is to avoid double-counting
-                                    // and includes exception for lo boundary.
-                                    // (3) Check if cell is obviously
-                                    // multiphase, then check if cell might have
-                                    // interface at top or bottom
-                                    if ((dout_ptr[n] > xm[2] + 0.5 * dx[2]) &&
-                                        (((plo[0] == loc[0] &&
-                                           xm[0] - loc[0] == 0.5 * dx[0]) ||
-                                          (xm[0] - loc[0] < 0.5 * dx[0] &&
-                                           loc[0] - xm[0] <= 0.5 * dx[0])) &&
-                                         ((plo[1] == loc[1] &&
-                                           xm[1] - loc[1] == 0.5 * dx[1]) ||
-                                          (xm[1] - loc[1] < 0.5 * dx[1] &&
-                                           loc[1] - xm[1] <= 0.5 * dx[1]))) &&
-                                        ((vof_arr(i, j, k) < (1.0 - 1e-12) &&
-                                          vof_arr(i, j, k) > 1e-12) ||
-                                         (vof_arr(i, j, k) < 1e-12 &&
-                                          (vof_arr(i, j, k + 1) >
-                                               (1.0 - 1e-12) ||
-                                           vof_arr(i, j, k - 1) >
-                                               (1.0 - 1e-12))))) {
-                                        // Interpolate in x and y for the
-                                        // current cell and the ones above and
-                                        // below
-                                        amrex::Real wx_hi;
-                                        amrex::Real wy_hi;
-                                        int iup, idn, jup, jdn;
-
-                                        // Determine which cells to use for x, y
-                                        if (loc[0] < xm[0]) {
-                                            iup = i;
-                                            idn = i - 1;
-                                            wx_hi = (loc[0] - (xm[0] - dx[0])) *
-                                                    dxi[0];
-                                        } else {
-                                            iup = i + 1;
-                                            idn = i;
-                                            wx_hi = (loc[0] - xm[0]) * dxi[0];
-                                        }
-                                        if (loc[1] < xm[1]) {
-                                            jup = j;
-                                            jdn = j - 1;
-                                            wy_hi = (loc[1] - (xm[1] - dx[1])) *
-                                                    dxi[1];
-                                        } else {
-                                            jup = j + 1;
-                                            jdn = j;
-                                            wy_hi = (loc[1] - xm[1]) * dxi[1];
-                                        }
-                                        amrex::Real wx_lo = 1.0 - wx_hi;
-                                        amrex::Real wy_lo = 1.0 - wy_hi;
-
-                                        amrex::Real vof_above =
-                                            wx_lo * wy_lo *
-                                                vof_arr(idn, jdn, k + 1) +
-                                            wx_lo * wy_hi *
-                                                vof_arr(idn, jup, k + 1) +
-                                            wx_hi * wy_lo *
-                                                vof_arr(iup, jdn, k + 1) +
-                                            wx_hi * wy_hi *
-                                                vof_arr(iup, jup, k + 1);
-                                        amrex::Real vof_here =
-                                            wx_lo * wy_lo *
-                                                vof_arr(idn, jdn, k) +
-                                            wx_lo * wy_hi *
-                                                vof_arr(idn, jup, k) +
-                                            wx_hi * wy_lo *
-                                                vof_arr(iup, jdn, k) +
-                                            wx_hi * wy_hi *
-                                                vof_arr(iup, jup, k);
-                                        amrex::Real vof_below =
-                                            wx_lo * wy_lo *
-                                                vof_arr(idn, jdn, k - 1) +
-                                            wx_lo * wy_hi *
-                                                vof_arr(idn, jup, k - 1) +
-                                            wx_hi * wy_lo *
-                                                vof_arr(iup, jdn, k - 1) +
-                                            wx_hi * wy_hi *
-                                                vof_arr(iup, jup, k - 1);
-
-                                        // Determine which cell to
-                                        // interpolate with
-                                        bool above = (vof_above - 0.5) *
-                                                         (vof_here - 0.5) <=
-                                                     0.0;
-                                        bool below = (vof_below - 0.5) *
-                                                         (vof_here - 0.5) <=
-                                                     0.0;
-                                        if (above) {
-                                            // Interpolate positive
-                                            // direction
-                                            ht = xm[2] +
-                                                 (dx[2]) /
-                                                     (vof_above - vof_here) *
-                                                     (0.5 - vof_here);
-                                        } else {
-                                            if (below) {
-                                                // Interpolate negative
-                                                // direction
-                                                ht =
-                                                    xm[2] -
-                                                    (dx[2]) /
-                                                        (vof_below - vof_here) *
-                                                        (0.5 - vof_here);
-                                            }
-                                            // If none satisfy requirement, then
-                                            // the isosurface vof = 0.5 cannot
-                                            // be detected in the z-direction
-                                        }
-                                    }
-                                    // Offset by removing lo and contribute to
-                                    // whole
-                                    height_fab = amrex::max(
-                                        height_fab,
-                                        mask_arr(i, j, k) * (ht - plo[2]));
-                                });
-                            return height_fab;
-                        }));
+                const int pi_lo = pt_lo[0];
+                const int pj_lo = pt_lo[1];
+                const int nbx = pt_hi[0] - pi_lo + 1;
+                const int nby = pt_hi[1] - pj_lo + 1;
+                const auto vof_arr = vof.const_array(mfi);
+                const auto mask_arr = level_mask[lev].const_array(mfi);
+
+                amrex::ParallelFor(
+                    nbx * nby, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        const int n =
+                            (pj_lo + ip / nbx) * npx + pi_lo + ip % nbx;
+                        const amrex::GpuArray<amrex::Real, 2> loc = {
+                            {dlocs_ptr[2 * n], dlocs_ptr[2 * n + 1]}};
+
+                        // Column of cells containing this point
+                        int i = 0;
+                        int j = 0;
+                        if (!containing_cell(loc[0], plo[0], dx[0], i) ||
+                            !containing_cell(loc[1], plo[1], dx[1], j) ||
+                            (i < lo.x) || (i > hi.x) || (j < lo.y) ||
+                            (j > hi.y)) {
+                            return;
+                        }
+
+                        amrex::Real height_col = 0.0;
+                        for (int k = lo.z; k <= hi.z; ++k) {
+                            // Check that cell height is below previous
+                            // instance
+                            const amrex::Real zm = plo[2] + (k + 0.5) * dx[2];
+                            if ((mask_arr(i, j, k) == 0) ||
+                                !(dout_ptr[n] > zm + 0.5 * dx[2])) {
+                                continue;
+                            }
+                            height_col = amrex::max(
+                                height_col,
+                                interface_height(
+                                    i, j, k, loc, plo, dx, dxi, vof_arr) -
+                                    plo[2]);
+                        }
+
+                        if (height_col > 0.0) {
+                            amrex::Gpu::Atomic::Max(
+                                &dheight_ptr[n], height_col);
+                        }
+                    });
             }
         }
 
-        // Loop points in 2D grid
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
-        }
+        // Gather heights from all ranks with a single reduction
+        auto* out_ptr = &m_out[ni * m_npts];
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, dheight.begin(), dheight.end(), out_ptr);
+        amrex::ParallelDescriptor::ReduceRealMax(out_ptr, m_npts);
         // Add problo back to heights, making them absolute, not relative
         for (int n = 0; n < m_npts; n++) {
-            m_out[ni * m_npts + n] += plo0[2];
+            out_ptr[n] += plo0[2];
         }
         // Copy last m_out to device vector
         amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &m_out[ni * m_npts],
-            &m_out[(ni + 1) * m_npts - 1] + 1, dout.begin());
+            amrex::Gpu::hostToDevice, out_ptr, out_ptr + m_npts, dout.begin());
     }
 
     process_output();
@@ -65,6 +65,7 @@ void Sampling::initialize()
         obj->initialize(key);
 
         m_total_particles += obj->num_points();
+        m_sampler_points.push_back(obj->num_points());
         m_samplers.emplace_back(std::move(obj));
     }
 
@@ -92,11 +93,30 @@ void Sampling::update_sampling_locations()
 {
     BL_PROFILE("amr-wind::Sampling::update_sampling_locations");
 
-    for (const auto& obj : m_samplers) {
+    bool has_moving = false;
+    bool resized = false;
+    size_t num_particles = 0;
+    for (int i = 0; i < static_cast<int>(m_samplers.size()); ++i) {
+        auto& obj = m_samplers[i];
         obj->update_sampling_locations();
+        has_moving = has_moving || !obj->is_static();
+        num_particles += obj->num_points();
+        if (obj->num_points() != m_sampler_points[i]) {
+            m_sampler_points[i] = obj->num_points();
+            resized = true;
+        }
     }
 
-    update_container();
+    // Rebuild the particles if the number of sampling locations of any
+    // sampler changed, as the particles are indexed by their position within
+    // each sampler. Otherwise, move the particles of the moving samplers in
+    // place.
+    if (resized) {
+        m_total_particles = num_particles;
+        update_container();
+    } else if (has_moving) {
+        m_scontainer->update_particle_positions(m_samplers);
+    }
 }
 
 void Sampling::post_advance_work()
@@ -1,3 +1,4 @@
+#include <cmath>
 
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
 #include "amr-wind/utilities/sampling/SamplerBase.H"
@@ -69,6 +70,41 @@ void sample_field(
                    wx_hi * wy_hi * wz_hi * farr(i + 1, j + 1, k + 1, ic);
     });
 }
+
+/** Gather the current locations of the moving samplers
+ *
+ *  \param samplers List of sampler objects
+ *  \param locs Flattened coordinates of all moving sampling locations
+ *  \param offsets Index of the first point of each sampler within `locs`
+ *  (indexed by sampler ID), -1 for static samplers
+ */
+void moving_locations(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers,
+    amrex::Vector<amrex::Real>& locs,
+    amrex::Vector<int>& offsets)
+{
+    locs.clear();
+    offsets.assign(samplers.size(), -1);
+
+    int npts_total = 0;
+    SamplerBase::SampleLocType slocs;
+    for (const auto& probe : samplers) {
+        if (probe->is_static()) {
+            continue;
+        }
+
+        AMREX_ASSERT(probe->id() < static_cast<int>(samplers.size()));
+        probe->sampling_locations(slocs);
+        const int npts = probe->num_points();
+        offsets[probe->id()] = npts_total;
+        for (int ip = 0; ip < npts; ++ip) {
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                locs.push_back(slocs[ip][n]);
+            }
+        }
+        npts_total += npts;
+    }
+}
 } // namespace
 
 void SamplingContainer::setup_container(
@@ -96,6 +132,13 @@ void SamplingContainer::initialize_particles(
 {
     BL_PROFILE("amr-wind::SamplingContainer::initialize");
 
+    // Track the positions of moving samplers on all ranks for subsequent
+    // position updates
+    {
+        amrex::Vector<int> offsets;
+        moving_locations(samplers, m_moving_locs, offsets);
+    }
+
     // We will assign all particles to the first box in level 0 and let
     // redistribute scatter it to the appropriate rank and box.
     const int lev = 0;
@@ -153,6 +196,79 @@ void SamplingContainer::initialize_particles(
     AMREX_ALWAYS_ASSERT(pidx == num_particles);
 }
 
+void SamplingContainer::update_particle_positions(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::update_positions");
+
+    amrex::Vector<amrex::Real> locs;
+    amrex::Vector<int> offsets;
+    moving_locations(samplers, locs, offsets);
+
+    // Determine the maximum distance moved by any particle since the last
+    // update. Samplers are replicated on all ranks, so no reduction is needed.
+    const bool same_size = (locs.size() == m_moving_locs.size());
+    amrex::Real max_disp = 0.0;
+    if (same_size) {
+        const int npts = static_cast<int>(locs.size()) / AMREX_SPACEDIM;
+        for (int ip = 0; ip < npts; ++ip) {
+            amrex::Real dist2 = 0.0;
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                const int ii = ip * AMREX_SPACEDIM + n;
+                const amrex::Real dd = locs[ii] - m_moving_locs[ii];
+                dist2 += dd * dd;
+            }
+            max_disp = amrex::max(max_disp, dist2);
+        }
+        max_disp = std::sqrt(max_disp);
+    }
+
+    amrex::Gpu::DeviceVector<amrex::Real> dlocs(locs.size());
+    amrex::Gpu::DeviceVector<int> doffsets(offsets.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, locs.begin(), locs.end(), dlocs.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, offsets.begin(), offsets.end(),
+        doffsets.begin());
+    const auto* dpos = dlocs.data();
+    const auto* doff = doffsets.data();
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                auto& pp = pstruct[ip];
+                const int off = doff[pp.idata(IIx::sid)];
+                if (off < 0) {
+                    return;
+                }
+
+                const int idx = (off + pp.idata(IIx::nid)) * AMREX_SPACEDIM;
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    pp.pos(n) = dpos[idx + n];
+                }
+            });
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+    m_moving_locs = std::move(locs);
+
+    // Particles that moved only a few cells need only be exchanged with
+    // neighboring boxes; fall back to a full redistribute otherwise.
+    const int finest = m_mesh.finestLevel();
+    const auto dxi = m_mesh.Geom(finest).InvCellSizeArray();
+    const amrex::Real dxi_max = amrex::max(dxi[0], dxi[1], dxi[2]);
+    const int ncells = static_cast<int>(std::ceil(max_disp * dxi_max)) + 1;
+    if (same_size && (ncells <= m_mesh.blockingFactor(finest).min())) {
+        Redistribute(0, finest, 0, ncells);
+    } else {
+        Redistribute();
+    }
+}
+
 void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
 {
     BL_PROFILE("amr-wind::SamplingContainer::interpolate");
@@ -141,4 +141,6 @@ void ABL::post_advance_work()
     m_bndry_plane->post_advance_work();
 }
 
+void ABL::post_regrid_actions() { m_bndry_plane->post_regrid_actions(); }
+
 } // namespace amr_wind
@@ -5,6 +5,10 @@
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include <AMReX_PlotFileUtil.H>
+#include <AMReX_VisMF.H>
+
+#include <cmath>
+#include <fstream>
 
 namespace amr_wind {
 
@@ -50,6 +54,226 @@ AMREX_FORCE_INLINE amrex::IntVect offset(const int face_dir, const int normal)
     return offset;
 }
 
+/** Read the FABs owned by this rank from a native boundary face file
+ *
+ *  This function does not perform any MPI communication and can be called
+ *  from a background thread. The data is read into FABs allocated in pinned
+ *  host memory.
+ *
+ *  \param facename Name of the face file (without the "_H" suffix)
+ *  \param ba Expected BoxArray of the face data
+ *  \param owned Indices of the boxes owned by this rank
+ *  \param fabs FABs read from file, keyed on the box index
+ *  \return False if the file could not be read
+ */
+bool read_native_face(
+    const std::string& facename,
+    const amrex::BoxArray& ba,
+    const amrex::Vector<int>& owned,
+    std::map<int, amrex::FArrayBox>& fabs)
+{
+    std::ifstream hdr_file(facename + "_H");
+    if (!hdr_file.good()) {
+        return false;
+    }
+
+    amrex::VisMF::Header hdr;
+    hdr_file >> hdr;
+    // Only files with FAB headers can be read independently of VisMF
+    if ((!hdr_file) || (hdr.m_vers != amrex::VisMF::Header::Version_v1) ||
+        (hdr.m_ba != ba)) {
+        return false;
+    }
+
+    const auto pos = facename.rfind('/');
+    const std::string dir_name =
+        (pos == std::string::npos) ? "" : facename.substr(0, pos + 1);
+    for (const int idx : owned) {
+        const auto& fod = hdr.m_fod[idx];
+        std::ifstream ifs(dir_name + fod.m_name, std::ios::binary);
+        if (!ifs.good()) {
+            return false;
+        }
+        ifs.seekg(fod.m_head, std::ios::beg);
+
+        amrex::FArrayBox fab(amrex::The_Pinned_Arena());
+        fab.readFrom(ifs);
+        if (!ifs) {
+            return false;
+        }
+        fabs.emplace(idx, std::move(fab));
+    }
+    return true;
+}
+
+/** Copy the inflow plane data onto the boundary ghost cells of a MultiFab
+ *
+ *  \param in_data Inflow data
+ *  \param ori Orientation of the boundary
+ *  \param lev Level of the plane data and the MultiFab
+ *  \param nstart Starting component of the field within the plane data
+ *  \param mfab MultiFab to be populated
+ */
+void copy_plane_data(
+    const InletData& in_data,
+    const amrex::Orientation ori,
+    const int lev,
+    const int nstart,
+    amrex::MultiFab& mfab)
+{
+    const auto& plane = in_data.interpolate_data(ori, lev);
+    if (!plane.ok()) {
+        return;
+    }
+
+    // The plane data is distributed following the level grids. If the
+    // destination uses different grids (e.g., during regrid) gather the
+    // plane data onto the ranks owning the destination boxes.
+    const amrex::MultiFab* src = &plane;
+    const amrex::Vector<int>* pindex = &in_data.plane_index(ori, lev);
+    amrex::MultiFab plane_tmp;
+    amrex::Vector<int> index_tmp;
+    if (!in_data.matches_grids(lev, mfab.boxArray(), mfab.DistributionMap())) {
+        amrex::BoxArray pba;
+        amrex::DistributionMapping pdm;
+        InletData::plane_layout(
+            mfab.boxArray(), mfab.DistributionMap(),
+            in_data.plane_box(ori, lev), pba, pdm, index_tmp);
+        if (pba.empty()) {
+            return;
+        }
+        plane_tmp.define(pba, pdm, plane.nComp(), 0);
+        plane_tmp.ParallelCopy(plane);
+        src = &plane_tmp;
+        pindex = &index_tmp;
+    }
+
+    const size_t nc = mfab.nComp();
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+
+        const int pidx = (*pindex)[mfi.index()];
+        if (pidx < 0) {
+            continue;
+        }
+
+        const auto& src_fab = (*src)[pidx];
+        const auto& bx = mfi.growntilebox(1) & src_fab.box();
+        if (bx.isEmpty()) {
+            continue;
+        }
+
+        const auto& dest = mfab.array(mfi);
+        const auto& src_arr = src_fab.const_array();
+        amrex::ParallelFor(
+            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                dest(i, j, k, n) = src_arr(i, j, k, n + nstart);
+            });
+    }
+}
+
+/** Interpolate the level 0 inflow plane data onto the boundary ghost cells of
+ *  a fine level MultiFab
+ *
+ *  The data is linearly interpolated in the directions tangential to the
+ *  boundary.
+ *
+ *  \param in_data Inflow data
+ *  \param ori Orientation of the boundary
+ *  \param ratio Refinement ratio between level 0 and the fine level
+ *  \param fine_pbx Boundary plane at the fine level
+ *  \param nstart Starting component of the field within the plane data
+ *  \param mfab MultiFab to be populated
+ */
+void interp_plane_data(
+    const InletData& in_data,
+    const amrex::Orientation ori,
+    const amrex::IntVect& ratio,
+    const amrex::Box& fine_pbx,
+    const int nstart,
+    amrex::MultiFab& mfab)
+{
+    const int lev_c = 0;
+    const auto& plane = in_data.interpolate_data(ori, lev_c);
+    if (!plane.ok()) {
+        return;
+    }
+
+    // Gather the coarse plane data onto the ranks owning the fine boxes
+    amrex::BoxArray cba(mfab.boxArray());
+    cba.coarsen(ratio);
+    amrex::BoxArray pba;
+    amrex::DistributionMapping pdm;
+    amrex::Vector<int> index_map;
+    InletData::plane_layout(
+        cba, mfab.DistributionMap(), in_data.plane_box(ori, lev_c), pba, pdm,
+        index_map);
+    if (pba.empty()) {
+        return;
+    }
+    amrex::MultiFab cplane(pba, pdm, plane.nComp(), 0);
+    cplane.ParallelCopy(plane);
+
+    const amrex::GpuArray<int, 2> perp = perpendicular_idx(ori.coordDir());
+    const size_t nc = mfab.nComp();
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+
+        const int pidx = index_map[mfi.index()];
+        if (pidx < 0) {
+            continue;
+        }
+
+        const auto& bx = mfi.growntilebox(1) & fine_pbx;
+        if (bx.isEmpty()) {
+            continue;
+        }
+
+        const auto& cfab = cplane[pidx];
+        const amrex::IntVect clo = cfab.box().smallEnd();
+        const amrex::IntVect chi = cfab.box().bigEnd();
+        const auto& dest = mfab.array(mfi);
+        const auto& src_arr = cfab.const_array();
+        amrex::ParallelFor(
+            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                const amrex::IntVect iv(i, j, k);
+                amrex::IntVect c00(clo);
+                amrex::IntVect c11(clo);
+                amrex::GpuArray<amrex::Real, 2> wt;
+                for (int d = 0; d < 2; ++d) {
+                    const int dir = perp[d];
+                    // Fine cell center in coarse index space
+                    const amrex::Real xc =
+                        (iv[dir] + 0.5) / ratio[dir] - 0.5;
+                    const int ic = static_cast<int>(amrex::Math::floor(xc));
+                    wt[d] = xc - ic;
+                    c00[dir] = amrex::max(amrex::min(ic, chi[dir]), clo[dir]);
+                    c11[dir] =
+                        amrex::max(amrex::min(ic + 1, chi[dir]), clo[dir]);
+                }
+                amrex::IntVect c10(c00);
+                amrex::IntVect c01(c00);
+                c10[perp[0]] = c11[perp[0]];
+                c01[perp[1]] = c11[perp[1]];
+
+                const int nc_src = n + nstart;
+                dest(i, j, k, n) =
+                    (1.0 - wt[0]) * (1.0 - wt[1]) * src_arr(c00, nc_src) +
+                    wt[0] * (1.0 - wt[1]) * src_arr(c10, nc_src) +
+                    (1.0 - wt[0]) * wt[1] * src_arr(c01, nc_src) +
+                    wt[0] * wt[1] * src_arr(c11, nc_src);
+            });
+    }
+}
+
 #ifdef AMR_WIND_USE_NETCDF
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE int
 plane_idx(const int i, const int j, const int k, const int perp, const int lo)
@@ -72,6 +296,8 @@ void InletData::resize(const int size)
     m_data_n.resize(size);
     m_data_np1.resize(size);
     m_data_interp.resize(size);
+    m_plane_box.resize(size);
+    m_plane_index.resize(size);
 }
 
 void InletData::define_plane(const amrex::Orientation ori)
@@ -79,17 +305,114 @@ void InletData::define_plane(const amrex::Orientation ori)
     m_data_n[ori] = std::make_unique<PlaneVector>();
     m_data_np1[ori] = std::make_unique<PlaneVector>();
     m_data_interp[ori] = std::make_unique<PlaneVector>();
+    m_plane_box[ori].clear();
+    m_plane_index[ori].clear();
 }
 
 void InletData::define_level_data(
-    const amrex::Orientation ori, const amrex::Box& bx, const size_t nc)
+    const amrex::Orientation ori,
+    const amrex::Box& bx,
+    const size_t nc,
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm)
 {
     if (!this->is_populated(ori)) {
         return;
     }
-    m_data_n[ori]->push_back(amrex::FArrayBox(bx, nc));
-    m_data_np1[ori]->push_back(amrex::FArrayBox(bx, nc));
-    m_data_interp[ori]->push_back(amrex::FArrayBox(bx, nc));
+
+    const int lev = static_cast<int>(m_data_n[ori]->size());
+    if (lev >= static_cast<int>(m_grids_ba.size())) {
+        m_grids_ba.resize(lev + 1);
+        m_grids_dm.resize(lev + 1);
+    }
+    m_grids_ba[lev] = ba;
+    m_grids_dm[lev] = dm;
+
+    amrex::BoxArray pba;
+    amrex::DistributionMapping pdm;
+    m_plane_box[ori].push_back(bx);
+    m_plane_index[ori].emplace_back();
+    plane_layout(ba, dm, bx, pba, pdm, m_plane_index[ori].back());
+
+    m_data_n[ori]->emplace_back();
+    m_data_np1[ori]->emplace_back();
+    m_data_interp[ori]->emplace_back();
+    if (pba.empty()) {
+        return;
+    }
+    m_data_n[ori]->back().define(pba, pdm, nc, 0);
+    m_data_np1[ori]->back().define(pba, pdm, nc, 0);
+    m_data_interp[ori]->back().define(pba, pdm, nc, 0);
+}
+
+void InletData::plane_layout(
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm,
+    const amrex::Box& pbx,
+    amrex::BoxArray& pba,
+    amrex::DistributionMapping& pdm,
+    amrex::Vector<int>& index_map)
+{
+    amrex::BoxList bl;
+    amrex::Vector<int> pmap;
+    index_map.assign(ba.size(), -1);
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        // Include the boundary ghost cells of boxes adjacent to the plane
+        const amrex::Box bx = amrex::grow(ba[i], 1) & pbx;
+        if (bx.isEmpty()) {
+            continue;
+        }
+        index_map[i] = static_cast<int>(pmap.size());
+        bl.push_back(bx);
+        pmap.push_back(dm[i]);
+    }
+
+    if (pmap.empty()) {
+        pba = amrex::BoxArray();
+        pdm = amrex::DistributionMapping();
+        return;
+    }
+    pba = amrex::BoxArray(std::move(bl));
+    pdm = amrex::DistributionMapping(std::move(pmap));
+}
+
+void InletData::regrid(
+    const int lev,
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm)
+{
+    if ((lev >= static_cast<int>(m_grids_ba.size())) ||
+        matches_grids(lev, ba, dm)) {
+        return;
+    }
+    m_grids_ba[lev] = ba;
+    m_grids_dm[lev] = dm;
+
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if ((!this->is_populated(ori)) ||
+            (lev >= static_cast<int>(m_data_n[ori]->size()))) {
+            continue;
+        }
+
+        auto& old_n = (*m_data_n[ori])[lev];
+        if (!old_n.ok()) {
+            continue;
+        }
+
+        amrex::BoxArray pba;
+        amrex::DistributionMapping pdm;
+        plane_layout(
+            ba, dm, m_plane_box[ori][lev], pba, pdm, m_plane_index[ori][lev]);
+        AMREX_ALWAYS_ASSERT(!pba.empty());
+
+        for (auto* pvec : {&m_data_n, &m_data_np1, &m_data_interp}) {
+            auto& old_mf = (*(*pvec)[ori])[lev];
+            amrex::MultiFab new_mf(pba, pdm, old_mf.nComp(), 0);
+            new_mf.ParallelCopy(old_mf);
+            old_mf = std::move(new_mf);
+        }
+    }
 }
 
 #ifdef AMR_WIND_USE_NETCDF
@@ -99,7 +422,8 @@ void InletData::read_data(
     const int lev,
     const Field* fld,
     const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const amrex::Vector<amrex::Real>& times,
+    const bool read_n)
 {
     const size_t nc = fld->num_comp();
     const int nstart = m_components[fld->id()];
@@ -113,38 +437,55 @@ void InletData::read_data(
     const int normal = ori.coordDir();
     const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
 
-    const auto& bx = (*m_data_n[ori])[lev].box();
-    const auto& lo = bx.loVect();
-    const size_t n0 = bx.length(perp[0]);
-    const size_t n1 = bx.length(perp[1]);
+    auto& mf_n = (*m_data_n[ori])[lev];
+    auto& mf_np1 = (*m_data_np1[ori])[lev];
+    if (!mf_n.ok()) {
+        return;
+    }
+
+    // Each rank only reads the patches of the plane that it owns. Indices in
+    // the file are relative to the low corner of the plane.
+    const auto& plo = m_plane_box[ori][lev].smallEnd();
+    for (amrex::MFIter mfi(mf_n); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const auto& lo = bx.loVect();
+        const size_t n0 = bx.length(perp[0]);
+        const size_t n1 = bx.length(perp[1]);
+
+        amrex::Vector<size_t> start{
+            static_cast<size_t>(idx),
+            static_cast<size_t>(lo[perp[0]] - plo[perp[0]]),
+            static_cast<size_t>(lo[perp[1]] - plo[perp[1]]), 0};
+        amrex::Vector<size_t> count{1, n0, n1, nc};
+        amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
+        auto d_buffer = buffer.dataPtr();
+        const int lo0 = lo[perp[0]];
+        const int lo1 = lo[perp[1]];
+
+        if (read_n) {
+            grp.var(fld->name()).get(buffer.data(), start, count);
+
+            const auto& datn = mf_n[mfi].array();
+            amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
+                const int i0 = plane_idx(i, j, k, perp[0], lo0);
+                const int i1 = plane_idx(i, j, k, perp[1], lo1);
+                datn(i, j, k, n + nstart) =
+                    d_buffer[((i0 * n1) + i1) * nc + n];
+            });
+            mf_n[mfi].prefetchToDevice();
+        }
 
-    amrex::Vector<size_t> start{
-        static_cast<size_t>(idx), static_cast<size_t>(lo[perp[0]]),
-        static_cast<size_t>(lo[perp[1]]), 0};
-    amrex::Vector<size_t> count{1, n0, n1, nc};
-    amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
-    grp.var(fld->name()).get(buffer.data(), start, count);
+        start[0] = static_cast<size_t>(idxp1);
+        grp.var(fld->name()).get(buffer.data(), start, count);
 
-    const auto& datn = ((*m_data_n[ori])[lev]).array();
-    auto d_buffer = buffer.dataPtr();
-    amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
-        const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-        const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datn(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
-    });
-
-    start[0] = static_cast<size_t>(idxp1);
-    grp.var(fld->name()).get(buffer.data(), start, count);
-
-    const auto& datnp1 = ((*m_data_np1[ori])[lev]).array();
-    amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
-        const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-        const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datnp1(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
-    });
-
-    ((*m_data_n[ori])[lev]).prefetchToDevice();
-    ((*m_data_np1[ori])[lev]).prefetchToDevice();
+        const auto& datnp1 = mf_np1[mfi].array();
+        amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
+            const int i0 = plane_idx(i, j, k, perp[0], lo0);
+            const int i1 = plane_idx(i, j, k, perp[1], lo1);
+            datnp1(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
+        });
+        mf_np1[mfi].prefetchToDevice();
+    }
 }
 
 #endif
@@ -156,7 +497,8 @@ void InletData::read_data_native(
     const int lev,
     const Field* fld,
     const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const amrex::Vector<amrex::Real>& times,
+    const bool read_n)
 {
     const size_t nc = fld->num_comp();
     const int nstart = m_components[fld->id()];
@@ -173,37 +515,47 @@ void InletData::read_data_native(
     AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry_n[ori].nComp());
     AMREX_ASSERT(bndry_n[ori].boxArray() == bndry_np1[ori].boxArray());
 
+    auto& mf_n = (*m_data_n[ori])[lev];
+    auto& mf_np1 = (*m_data_np1[ori])[lev];
+    if (!mf_n.ok()) {
+        return;
+    }
+
     const int normal = ori.coordDir();
-    const auto& bbx = (*m_data_n[ori])[lev].box();
+    const auto& bbx = m_plane_box[ori][lev];
     const amrex::IntVect v_offset = offset(ori.faceDir(), normal);
 
     amrex::MultiFab bndry(
         bndry_n[ori].boxArray(), bndry_n[ori].DistributionMap(),
         bndry_n[ori].nComp(), 0, amrex::MFInfo());
 
-    for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
+    if (read_n) {
+        for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
 
-        const auto& vbx = mfi.validbox();
-        const auto& bndry_n_arr = bndry_n[ori].array(mfi);
-        const auto& bndry_arr = bndry.array(mfi);
+            const auto& vbx = mfi.validbox();
+            const auto& bndry_n_arr = bndry_n[ori].array(mfi);
+            const auto& bndry_arr = bndry.array(mfi);
 
-        const auto& bx = bbx & vbx;
-        if (bx.isEmpty()) {
-            continue;
+            const auto& bx = bbx & vbx;
+            if (bx.isEmpty()) {
+                continue;
+            }
+
+            amrex::ParallelFor(
+                bx, nc,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    bndry_arr(i, j, k, n) =
+                        0.5 * (bndry_n_arr(i, j, k, n) +
+                               bndry_n_arr(
+                                   i + v_offset[0], j + v_offset[1],
+                                   k + v_offset[2], n));
+                });
         }
 
-        amrex::ParallelFor(
-            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_n_arr(i, j, k, n) +
-                     bndry_n_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
-            });
+        // Scatter the plane to the ranks owning the adjacent boxes
+        mf_n.ParallelCopy(bndry, 0, nstart, nc);
     }
 
-    bndry.copyTo((*m_data_n[ori])[lev], 0, nstart, nc);
-
     for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
         const auto& vbx = mfi.validbox();
         const auto& bndry_np1_arr = bndry_np1[ori].array(mfi);
@@ -224,7 +576,13 @@ void InletData::read_data_native(
             });
     }
 
-    bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, nc);
+    mf_np1.ParallelCopy(bndry, 0, nstart, nc);
+}
+
+void InletData::rotate()
+{
+    std::swap(m_data_n, m_data_np1);
+    m_tn = m_tnp1;
 }
 
 void InletData::interpolate(const amrex::Real time)
@@ -242,9 +600,15 @@ void InletData::interpolate(const amrex::Real time)
             const auto& datn = (*m_data_n[ori])[lev];
             const auto& datnp1 = (*m_data_np1[ori])[lev];
             auto& dati = (*m_data_interp[ori])[lev];
-            dati.linInterp<amrex::RunOn::Device>(
-                datn, 0, datnp1, 0, m_tn, m_tnp1, m_tinterp, datn.box(), 0,
-                dati.nComp());
+            if (!dati.ok()) {
+                continue;
+            }
+
+            for (amrex::MFIter mfi(dati); mfi.isValid(); ++mfi) {
+                dati[mfi].linInterp<amrex::RunOn::Device>(
+                    datn[mfi], 0, datnp1[mfi], 0, m_tn, m_tnp1, m_tinterp,
+                    mfi.validbox(), 0, dati.nComp());
+            }
         }
     }
 }
@@ -281,6 +645,7 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
+    pp.query("bndry_prefetch", m_prefetch_planes);
 
 #ifndef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
@@ -373,6 +738,9 @@ void ABLBoundaryPlane::write_header()
         ncf.def_dim("nt", NC_UNLIMITED);
         ncf.def_var("time", NC_DOUBLE, {"nt"});
 
+        m_out_plane_lo.clear();
+        m_out_plane_lo.resize(m_plane_names.size());
+
         for (amrex::OrientationIter oit; oit; ++oit) {
             auto ori = oit();
             const std::string plane = m_plane_names[ori];
@@ -404,6 +772,10 @@ void ABLBoundaryPlane::write_header()
                 const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
                 if (!box_intersects_boundary(minBox, lev, ori)) break;
 
+                // Indices in the file are relative to this low corner
+                m_out_plane_lo[ori].push_back(
+                    {{minBox.smallEnd(perp[0]), minBox.smallEnd(perp[1])}});
+
                 auto lev_grp = plane_grp.def_group(level_name(lev));
                 lev_grp.def_dim("nx", minBox.length(0));
                 lev_grp.def_dim("ny", minBox.length(1));
@@ -632,52 +1004,76 @@ void ABLBoundaryPlane::read_header()
 
             m_in_data.define_plane(ori);
 
-            const int nlevels = plane_grp.num_groups();
-            // FIXME Do not support multi-level input mode yet.
-            // this is due to interpolation issues at the coarse-fine interface
-            if (nlevels > 1) {
-                amrex::Abort("Not supporting multi-level input mode yet.");
+            size_t nc = 0;
+            for (auto* fld : m_fields) {
+                m_in_data.component(fld->id()) = nc;
+                nc += fld->num_comp();
             }
+
+            const int nlevels =
+                amrex::min(plane_grp.num_groups(), m_mesh.maxLevel() + 1);
             for (int lev = 0; lev < nlevels; ++lev) {
                 auto lev_grp = plane_grp.group(level_name(lev));
 
-                // sanity checks to ensure grid-to-grid matching
-                const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
-                const auto& lo = minBox.loVect();
-                const auto& hi = minBox.hiVect();
                 const auto& dx = m_mesh.Geom(lev).CellSizeArray();
                 const amrex::Vector<amrex::Real> pdx{
                     {dx[perp[0]], dx[perp[1]]}};
-                const amrex::Vector<amrex::Real> los{
-                    {lo[perp[0]] * pdx[0], lo[perp[1]] * pdx[1]}};
-                const amrex::Vector<amrex::Real> his{
-                    {(hi[perp[0]] + 1) * pdx[0], (hi[perp[1]] + 1) * pdx[1]}};
-                const amrex::Vector<amrex::Real> lengths{
-                    {minBox.length(perp[0]) * pdx[0],
-                     minBox.length(perp[1]) * pdx[1]}};
-
                 amrex::Vector<amrex::Real> nc_dat{{0, 0}};
-                lev_grp.var("lengths").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == lengths);
-                lev_grp.var("lo").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == los);
-                lev_grp.var("hi").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == his);
+                amrex::Vector<amrex::Real> file_lo{{0, 0}};
+                amrex::Vector<amrex::Real> file_hi{{0, 0}};
                 lev_grp.var("dx").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == pdx);
+                lev_grp.var("lo").get(file_lo.data());
+                lev_grp.var("hi").get(file_hi.data());
+
+                if (lev == 0) {
+                    // sanity checks to ensure grid-to-grid matching
+                    const amrex::Box& minBox =
+                        m_mesh.boxArray(lev).minimalBox();
+                    const auto& lo = minBox.loVect();
+                    const auto& hi = minBox.hiVect();
+                    const amrex::Vector<amrex::Real> los{
+                        {lo[perp[0]] * pdx[0], lo[perp[1]] * pdx[1]}};
+                    const amrex::Vector<amrex::Real> his{
+                        {(hi[perp[0]] + 1) * pdx[0],
+                         (hi[perp[1]] + 1) * pdx[1]}};
+                    const amrex::Vector<amrex::Real> lengths{
+                        {minBox.length(perp[0]) * pdx[0],
+                         minBox.length(perp[1]) * pdx[1]}};
+
+                    AMREX_ALWAYS_ASSERT(nc_dat == pdx);
+                    AMREX_ALWAYS_ASSERT(file_lo == los);
+                    AMREX_ALWAYS_ASSERT(file_hi == his);
+                    lev_grp.var("lengths").get(nc_dat.data());
+                    AMREX_ALWAYS_ASSERT(nc_dat == lengths);
+                } else if (nc_dat != pdx) {
+                    // Fine levels are interpolated from coarse data instead
+                    amrex::Print()
+                        << "WARNING: ABLBoundaryPlane: resolution mismatch, "
+                           "ignoring inflow data at level "
+                        << lev << " and above for " << m_plane_names[ori]
+                        << std::endl;
+                    break;
+                }
 
-                // Create the data structures for the input data
-                amrex::IntVect plo(lo);
-                amrex::IntVect phi(hi);
-                plo[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
-                phi[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
-                const amrex::Box pbx(plo, phi);
-                size_t nc = 0;
-                for (auto* fld : m_fields) {
-                    m_in_data.component(fld->id()) = nc;
-                    nc += fld->num_comp();
+                // Create the data structures for the input data covering the
+                // extents of the plane in the file
+                const amrex::Box& domain = m_mesh.Geom(lev).Domain();
+                amrex::IntVect plo(domain.smallEnd());
+                amrex::IntVect phi(domain.bigEnd());
+                for (int i = 0; i < 2; ++i) {
+                    plo[perp[i]] =
+                        static_cast<int>(std::round(file_lo[i] / pdx[i]));
+                    phi[perp[i]] =
+                        static_cast<int>(std::round(file_hi[i] / pdx[i])) - 1;
                 }
-                m_in_data.define_level_data(ori, pbx, nc);
+                plo[normal] = ori.isHigh() ? domain.bigEnd(normal) + 1 : -1;
+                phi[normal] = ori.isHigh() ? domain.bigEnd(normal) + 1 : -1;
+                const amrex::Box pbx(plo, phi);
+
+                amrex::BoxArray ba;
+                amrex::DistributionMapping dm;
+                plane_grids(lev, ba, dm);
+                m_in_data.define_level_data(ori, pbx, nc, ba, dm);
             }
         }
 
@@ -736,7 +1132,7 @@ void ABLBoundaryPlane::read_header()
             nc += fld->num_comp();
         }
 
-        // FIXME: need to generalize to lev > 0 somehow
+        // Native files only contain level 0 data, fine levels are interpolated
         const int lev = 0;
         for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
             auto ori = oit();
@@ -756,7 +1152,10 @@ void ABLBoundaryPlane::read_header()
             plo[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
             phi[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
             const amrex::Box pbx(plo, phi);
-            m_in_data.define_level_data(ori, pbx, nc);
+            amrex::BoxArray ba;
+            amrex::DistributionMapping dm;
+            plane_grids(lev, ba, dm);
+            m_in_data.define_level_data(ori, pbx, nc, ba, dm);
         }
     }
 }
@@ -778,6 +1177,14 @@ void ABLBoundaryPlane::read_file()
         return;
     }
 
+    // If the simulation moved to the next time window, the data at n+1 is
+    // reused for n and only the data at n+1 needs to be read
+    const int index = closest_index(m_in_times, time);
+    const bool rotate = (m_in_index >= 0) && (index == m_in_index + 1);
+    if (rotate) {
+        m_in_data.rotate();
+    }
+
 #ifdef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
 
@@ -790,11 +1197,12 @@ void ABLBoundaryPlane::read_file()
             if (!m_in_data.is_populated(ori)) continue;
 
             const std::string plane = m_plane_names[ori];
-            const int nlevels = ncf.group(plane).num_groups();
+            const int nlevels = m_in_data.nlevels(ori);
             for (auto* fld : m_fields) {
                 for (int lev = 0; lev < nlevels; ++lev) {
                     auto grp = ncf.group(plane).group(level_name(lev));
-                    m_in_data.read_data(grp, ori, lev, fld, time, m_in_times);
+                    m_in_data.read_data(
+                        grp, ori, lev, fld, time, m_in_times, !rotate);
                 }
             }
         }
@@ -804,68 +1212,221 @@ void ABLBoundaryPlane::read_file()
 
     if (m_out_fmt == "native") {
 
-        const int index = closest_index(m_in_times, time);
-        const int t_step1 = m_in_timesteps[index];
-        const int t_step2 = m_in_timesteps[index + 1];
-
         AMREX_ALWAYS_ASSERT(
             (m_in_times[index] <= time) && (time <= m_in_times[index + 1]));
 
-        const std::string chkname1 =
-            m_filename + amrex::Concatenate("/bndry_output", t_step1);
-        const std::string chkname2 =
-            m_filename + amrex::Concatenate("/bndry_output", t_step2);
+        NativePlaneData data_n;
+        if (!rotate) {
+            read_native_planes(index, data_n, false);
+        }
 
-        const std::string level_prefix = "Level_";
+        // Use the data read in the background if it is for the right time
+        NativePlaneData data_np1;
+        if (m_prefetch.index == index + 1) {
+            wait_native_planes(m_prefetch);
+            data_np1 = std::move(m_prefetch);
+        } else {
+            // Discard data read ahead for a different time window
+            if (m_prefetch.status.valid()) {
+                m_prefetch.status.wait();
+            }
+            read_native_planes(index + 1, data_np1, false);
+        }
+        m_prefetch = NativePlaneData();
 
         const int lev = 0;
-        for (auto* fld : m_fields) {
-
-            auto& field = *fld;
-            const auto& geom = field.repo().mesh().Geom();
-
-            amrex::Box domain = geom[lev].Domain();
-            amrex::BoxArray ba(domain);
-            amrex::DistributionMapping dm{ba};
-
-            amrex::BndryRegister bndry1(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
-            amrex::BndryRegister bndry2(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
-
-            bndry1.setVal(1.0e13);
-            bndry2.setVal(1.0e13);
-
-            std::string filename1 = amrex::MultiFabFileFullPrefix(
-                lev, chkname1, level_prefix, field.name());
-            std::string filename2 = amrex::MultiFabFileFullPrefix(
-                lev, chkname2, level_prefix, field.name());
+        for (int ifld = 0; ifld < static_cast<int>(m_fields.size()); ++ifld) {
+            auto* fld = m_fields[ifld];
+            auto& bndry_np1 = *data_np1.bndry[ifld];
+            auto& bndry_n = rotate ? bndry_np1 : *data_n.bndry[ifld];
 
             for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
                 auto ori = oit();
 
                 if ((!m_in_data.is_populated(ori)) ||
-                    (field.bc_type()[ori] != BC::mass_inflow)) {
+                    (fld->bc_type()[ori] != BC::mass_inflow)) {
                     continue;
                 }
 
-                std::string facename1 =
-                    amrex::Concatenate(filename1 + '_', ori, 1);
-                std::string facename2 =
-                    amrex::Concatenate(filename2 + '_', ori, 1);
-
-                bndry1[ori].read(facename1);
-                bndry2[ori].read(facename2);
-
                 m_in_data.read_data_native(
-                    oit, bndry1, bndry2, lev, fld, time, m_in_times);
+                    oit, bndry_n, bndry_np1, lev, fld, time, m_in_times,
+                    !rotate);
             }
         }
+
+        // Start reading the data for the next time window
+        if (m_prefetch_planes &&
+            (index + 2 < static_cast<int>(m_in_times.size()))) {
+            read_native_planes(index + 2, m_prefetch, true);
+        }
     }
 
+    m_in_index = index;
     m_in_data.interpolate(time);
 }
 
+void ABLBoundaryPlane::post_regrid_actions()
+{
+    if ((!m_is_initialized) || (m_io_mode != io_mode::input)) {
+        return;
+    }
+
+    for (int lev = 0; lev <= m_mesh.maxLevel(); ++lev) {
+        amrex::BoxArray ba;
+        amrex::DistributionMapping dm;
+        plane_grids(lev, ba, dm);
+        m_in_data.regrid(lev, ba, dm);
+    }
+}
+
+void ABLBoundaryPlane::plane_grids(
+    const int lev, amrex::BoxArray& ba, amrex::DistributionMapping& dm) const
+{
+    ba = m_mesh.boxArray(0);
+    dm = m_mesh.DistributionMap(0);
+    if (lev > 0) {
+        amrex::IntVect ratio(1);
+        for (int l = 0; l < lev; ++l) {
+            ratio *= m_mesh.refRatio(l);
+        }
+        ba.refine(ratio);
+    }
+}
+
+void ABLBoundaryPlane::read_native_planes(
+    const int index, NativePlaneData& pd, const bool async)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_native_planes");
+
+    const int t_step = m_in_timesteps[index];
+    const std::string chkname =
+        m_filename + amrex::Concatenate("/bndry_output", t_step);
+    const std::string level_prefix = "Level_";
+
+    pd.index = index;
+    pd.bndry.clear();
+    pd.faces.clear();
+    pd.staged.clear();
+
+    const int lev = 0;
+    for (int ifld = 0; ifld < static_cast<int>(m_fields.size()); ++ifld) {
+        auto& field = *m_fields[ifld];
+        const auto& geom = field.repo().mesh().Geom();
+
+        amrex::Box domain = geom[lev].Domain();
+        amrex::BoxArray ba(domain);
+        amrex::DistributionMapping dm{ba};
+
+        pd.bndry.emplace_back(std::make_unique<amrex::BndryRegister>(
+            ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp()));
+        pd.bndry.back()->setVal(1.0e13);
+
+        std::string filename = amrex::MultiFabFileFullPrefix(
+            lev, chkname, level_prefix, field.name());
+
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+
+            if ((!m_in_data.is_populated(ori)) ||
+                (field.bc_type()[ori] != BC::mass_inflow)) {
+                continue;
+            }
+
+            pd.faces.emplace_back(
+                ifld, static_cast<int>(ori),
+                amrex::Concatenate(filename + '_', ori, 1));
+        }
+    }
+
+    if (!async) {
+        for (const auto& face : pd.faces) {
+            const amrex::Orientation ori(std::get<1>(face));
+            (*pd.bndry[std::get<0>(face)])[ori].read(std::get<2>(face));
+        }
+        return;
+    }
+
+    // Gather the information required by the background thread so that it
+    // does not need to access any of the AMReX data structures
+    struct FaceInfo
+    {
+        std::tuple<int, int, int> key;
+        std::string name;
+        amrex::BoxArray ba;
+        amrex::Vector<int> owned;
+    };
+    amrex::Vector<FaceInfo> info;
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    for (const auto& face : pd.faces) {
+        const int ifld = std::get<0>(face);
+        const amrex::Orientation ori(std::get<1>(face));
+        const auto& fs = (*pd.bndry[ifld])[ori];
+        FaceInfo fi;
+        fi.key = std::make_tuple(ifld, std::get<1>(face), 0);
+        fi.name = std::get<2>(face);
+        fi.ba = fs.boxArray();
+        for (int i = 0; i < static_cast<int>(fi.ba.size()); ++i) {
+            if (fs.DistributionMap()[i] == iproc) {
+                fi.owned.push_back(i);
+            }
+        }
+        info.push_back(std::move(fi));
+    }
+
+    auto* staged = &pd.staged;
+    pd.status = std::async(
+        std::launch::async, [info = std::move(info), staged]() -> bool {
+            for (const auto& fi : info) {
+                std::map<int, amrex::FArrayBox> fabs;
+                if (!read_native_face(fi.name, fi.ba, fi.owned, fabs)) {
+                    return false;
+                }
+                for (auto& it : fabs) {
+                    auto key = fi.key;
+                    std::get<2>(key) = it.first;
+                    staged->emplace(key, std::move(it.second));
+                }
+            }
+            return true;
+        });
+}
+
+void ABLBoundaryPlane::wait_native_planes(NativePlaneData& pd)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::wait_native_planes");
+
+    if (!pd.status.valid()) {
+        return;
+    }
+
+    bool success = pd.status.get();
+    amrex::ParallelDescriptor::ReduceBoolAnd(success);
+
+    // Fall back to reading the files with VisMF if any rank failed
+    if (!success) {
+        pd.staged.clear();
+        for (const auto& face : pd.faces) {
+            const amrex::Orientation ori(std::get<1>(face));
+            (*pd.bndry[std::get<0>(face)])[ori].read(std::get<2>(face));
+        }
+        return;
+    }
+
+    for (const auto& face : pd.faces) {
+        const int ifld = std::get<0>(face);
+        const amrex::Orientation ori(std::get<1>(face));
+        auto& fs = (*pd.bndry[ifld])[ori];
+        for (amrex::MFIter mfi(fs); mfi.isValid(); ++mfi) {
+            const auto found = pd.staged.find(
+                std::make_tuple(ifld, std::get<1>(face), mfi.index()));
+            AMREX_ALWAYS_ASSERT(found != pd.staged.end());
+            fs[mfi].copy<amrex::RunOn::Device>(found->second);
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+    pd.staged.clear();
+}
+
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 void ABLBoundaryPlane::populate_data(
     const int lev,
@@ -891,49 +1452,38 @@ void ABLBoundaryPlane::populate_data(
             continue;
         }
 
-        // Ensure the fine level does not touch the inflow boundary
-        if (lev > 0) {
-            const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
-            if (box_intersects_boundary(minBox, lev, ori)) {
-                amrex::Abort(
-                    "Fine level intersects inflow boundary, not supported "
-                    "yet.");
-            } else {
-                continue;
-            }
+        // Ensure inflow data exists
+        if (m_in_data.nlevels(ori) < 1) {
+            amrex::Abort("No inflow data at level 0.");
         }
 
-        // Ensure inflow data exists at this level
-        if (lev >= m_in_data.nlevels(ori)) {
-            amrex::Abort("No inflow data at this level.");
+        const int nstart = m_in_data.component(static_cast<int>(fld.id()));
+        if (lev == 0) {
+            copy_plane_data(m_in_data, ori, lev, nstart, mfab);
+            continue;
         }
 
-        // const int normal = ori.coordDir();
-        // const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
-
-        const size_t nc = mfab.nComp();
-
-#ifdef _OPENMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-        for (amrex::MFIter mfi(mfab, amrex::TilingIfNotGPU()); mfi.isValid();
-             ++mfi) {
-
-            const auto& sbx = mfi.growntilebox(1);
-            const auto& src = m_in_data.interpolate_data(ori, lev);
-            const auto& bx = sbx & src.box();
-            if (bx.isEmpty()) {
-                continue;
-            }
+        // Skip fine levels that do not touch the inflow boundary
+        const amrex::Box& domain = m_mesh.Geom(lev).Domain();
+        const int normal = ori.coordDir();
+        const int pidx = ori.isHigh() ? domain.bigEnd(normal) + 1
+                                      : domain.smallEnd(normal) - 1;
+        amrex::Box pbx(domain);
+        pbx.setSmall(normal, pidx);
+        pbx.setBig(normal, pidx);
+        if (!amrex::grow(mfab.boxArray().minimalBox(), 1).intersects(pbx)) {
+            continue;
+        }
 
-            const auto& dest = mfab.array(mfi);
-            const auto& src_arr = src.array();
-            const int nstart = m_in_data.component(static_cast<int>(fld.id()));
-            amrex::ParallelFor(
-                bx, nc,
-                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                    dest(i, j, k, n) = src_arr(i, j, k, n + nstart);
-                });
+        // Interpolate from level 0 and overwrite with the fine level data
+        // where it is available
+        amrex::IntVect ratio(1);
+        for (int l = 0; l < lev; ++l) {
+            ratio *= m_mesh.refRatio(l);
+        }
+        interp_plane_data(m_in_data, ori, ratio, pbx, nstart, mfab);
+        if (lev < m_in_data.nlevels(ori)) {
+            copy_plane_data(m_in_data, ori, lev, nstart, mfab);
         }
     }
 
@@ -966,6 +1516,9 @@ void ABLBoundaryPlane::write_data(
 
     AMREX_ALWAYS_ASSERT(dlo[0] == 0 && dlo[1] == 0 && dlo[2] == 0);
 
+    // Indices in the file are relative to the low corner of the plane
+    const auto& plo = m_out_plane_lo[ori][lev];
+
     grp.var(name).par_access(NC_COLLECTIVE);
 
     // FIXME optimization
@@ -1003,8 +1556,8 @@ void ABLBoundaryPlane::write_data(
             amrex::Gpu::streamSynchronize();
 
             buffer.start = {
-                m_out_counter, static_cast<size_t>(lo[perp[0]]),
-                static_cast<size_t>(lo[perp[1]]), 0};
+                m_out_counter, static_cast<size_t>(lo[perp[0]] - plo[0]),
+                static_cast<size_t>(lo[perp[1]] - plo[1]), 0};
             buffer.count = {1, n0, n1, nc};
         } else if (bhi[normal] == dhi[normal] && ori.isHigh()) {
             amrex::IntVect lo(blo);
@@ -1026,8 +1579,8 @@ void ABLBoundaryPlane::write_data(
             amrex::Gpu::streamSynchronize();
 
             buffer.start = {
-                m_out_counter, static_cast<size_t>(lo[perp[0]]),
-                static_cast<size_t>(lo[perp[1]]), 0};
+                m_out_counter, static_cast<size_t>(lo[perp[0]] - plo[0]),
+                static_cast<size_t>(lo[perp[1]] - plo[1]), 0};
             buffer.count = {1, n0, n1, nc};
         }
     }
@@ -32,7 +32,17 @@ ABLStats::ABLStats(
     , m_pa_tu(m_pa_vel, m_pa_temp)
     , m_pa_uu(m_pa_vel, m_pa_vel)
     , m_pa_uuu(m_pa_vel, m_pa_vel, m_pa_vel)
-{}
+{
+    m_pa_profiles.add(m_pa_vel);
+    m_pa_profiles.add(m_pa_temp);
+
+    m_pa_stats.add(m_pa_vel);
+    m_pa_stats.add(m_pa_temp);
+    m_pa_stats.add(m_pa_mueff);
+    m_pa_stats.add(m_pa_tu);
+    m_pa_stats.add(m_pa_uu);
+    m_pa_stats.add(m_pa_uuu);
+}
 
 ABLStats::~ABLStats() = default;
 
@@ -87,11 +97,7 @@ void ABLStats::initialize()
     }
 }
 
-void ABLStats::calc_averages()
-{
-    m_pa_vel();
-    m_pa_temp();
-}
+void ABLStats::calc_averages() { m_pa_profiles(); }
 
 //! Calculate sfs stress averages
 void ABLStats::calc_sfs_stress_avgs(
@@ -146,16 +152,18 @@ void ABLStats::post_advance_work()
 {
     BL_PROFILE("amr-wind::ABLStats::post_advance_work");
 
-    // Always compute mean velocity/temperature profiles
-    calc_averages();
-
     const auto& time = m_sim.time();
     const int tidx = time.time_index();
     // Skip processing if it is not an output timestep
     if (!(tidx % m_out_freq == 0)) {
+        // Only the mean velocity/temperature profiles are needed
+        calc_averages();
         return;
     }
 
+    // Compute the mean profiles along with all the moments in a single pass
+    m_pa_stats();
+
     switch (m_normal_dir) {
     case 0:
         compute_zi(YDir(), ZDir());
@@ -168,10 +176,6 @@ void ABLStats::post_advance_work()
         break;
     }
 
-    m_pa_tu();
-    m_pa_uu();
-    m_pa_uuu();
-
     process_output();
 }
 
@@ -2,8 +2,10 @@
 #include "amr-wind/wind_energy/actuator/ActuatorModel.H"
 #include "amr-wind/wind_energy/actuator/ActParser.H"
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
+#include "amr-wind/wind_energy/actuator/actuator_utils.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/core/LoadBalancer.H"
 
 #include <algorithm>
 #include <memory>
@@ -177,6 +179,14 @@ void Actuator::compute_forces()
             ac->compute_forces();
         }
     }
+
+    // Complete the force computations only after they have been started for
+    // all actuators, so that any communication can overlap
+    for (auto& ac : m_actuators) {
+        if (ac->info().actuator_in_proc) {
+            ac->finish_forces();
+        }
+    }
 }
 
 void Actuator::compute_source_term()
@@ -185,6 +195,12 @@ void Actuator::compute_source_term()
     m_act_source.setVal(0.0);
     const int nlevels = m_sim.repo().num_active_levels();
 
+    // Cells within the actuator bounding boxes are more expensive
+    auto& lb = m_sim.load_balancer();
+    const bool collect_costs = lb.collect_costs();
+    const amrex::Real cost_weight =
+        collect_costs ? lb.weight("actuator", 2.0) : 0.0;
+
     for (int lev = 0; lev < nlevels; ++lev) {
         auto& sfab = m_act_source(lev);
         const auto& geom = m_sim.mesh().Geom(lev);
@@ -196,6 +212,15 @@ void Actuator::compute_source_term()
             for (auto& ac : m_actuators) {
                 if (ac->info().actuator_in_proc) {
                     ac->compute_source_term(lev, mfi, geom);
+
+                    if (collect_costs) {
+                        const auto abx =
+                            utils::realbox_to_box(ac->info().bound_box, geom);
+                        const auto ncells = (mfi.validbox() & abx).numPts();
+                        lb.add_cost(
+                            lev, mfi,
+                            cost_weight * static_cast<amrex::Real>(ncells));
+                    }
                 }
             }
         }
@@ -6,6 +6,7 @@
 #include "AMReX_Scan.H"
 
 #include <algorithm>
+#include <string>
 
 namespace amr_wind {
 namespace actuator {
@@ -25,8 +26,6 @@ ActuatorContainer::ActuatorContainer(
     , m_data(num_objects)
     , m_proc_pos(amrex::ParallelDescriptor::NProcs(), vs::Vector::zero())
     , m_pos_device(amrex::ParallelDescriptor::NProcs(), vs::Vector::zero())
-    , m_proc_offsets(amrex::ParallelDescriptor::NProcs() + 1, 0)
-    , m_proc_offsets_device(amrex::ParallelDescriptor::NProcs() + 1)
 {}
 
 /** Allocate memory and initialize the particles within the container
@@ -50,25 +49,6 @@ void ActuatorContainer::initialize_container()
     m_data.position.resize(total_pts);
     m_data.velocity.resize(total_pts);
 
-    {
-        const int nproc = amrex::ParallelDescriptor::NProcs();
-        amrex::Vector<int> pts_per_proc(nproc, 0);
-#ifdef AMREX_USE_MPI
-        MPI_Allgather(
-            &total_pts, 1, MPI_INT, pts_per_proc.data(), 1, MPI_INT,
-            amrex::ParallelDescriptor::Communicator());
-#else
-        pts_per_proc[0] = total_pts;
-#endif
-        m_proc_offsets[0] = 0;
-        for (int i = 1; i <= nproc; ++i) {
-            m_proc_offsets[i] = m_proc_offsets[i - 1] + pts_per_proc[i - 1];
-        }
-        amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, m_proc_offsets.begin(),
-            m_proc_offsets.end(), m_proc_offsets_device.begin());
-    }
-
     initialize_particles(total_pts);
 }
 
@@ -214,51 +194,160 @@ void ActuatorContainer::sample_velocities(const Field& vel)
 
 /** Helper method for ActuatorContainer::sample_velocities
  *
- *  Loops over the particle tiles and copies velocity data from particles to the
- *  velocity array.
+ *  Loops over the particle tiles and sends the velocity data from the
+ *  particles to the MPI rank where the particle was created (i.e., the rank
+ *  that holds the turbines the point belongs to). Every rank only exchanges
+ *  data with the ranks that sampled its points, or that own the points it
+ *  sampled. The number of points each rank receives is obtained with a single
+ *  reduction of the per-destination counts, so that the receive loop does not
+ *  depend on every point having been sampled. Points that were lost (e.g.,
+ *  particles dropped by Redistribute) cause an abort instead of a hang.
  */
 void ActuatorContainer::populate_vel_buffer()
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::populate_vel_buffer");
-    amrex::Vector<vs::Vector> velh(m_proc_offsets.back());
-    amrex::Gpu::DeviceVector<vs::Vector> vel(
-        m_proc_offsets.back(), vs::Vector::zero());
-    auto* varr = vel.data();
-    auto* offsets = m_proc_offsets_device.data();
+    // Point index and velocity vector sent for every particle
+    constexpr int msg_size = 1 + AMREX_SPACEDIM;
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
     const int nlevels = m_mesh.finestLevel() + 1;
+
+    int num_particles = 0;
     for (int lev = 0; lev < nlevels; ++lev) {
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
-            const int np = pti.numParticles();
-            auto* pstruct = pti.GetArrayOfStructs()().data();
+            num_particles += pti.numParticles();
+        }
+    }
 
-            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                auto& pp = pstruct[ip];
-                const auto iproc = pp.cpu();
-                const auto idx = offsets[iproc] + pp.idata(0);
+    // Pack the owning rank, point index, and velocity of the particles
+    amrex::Gpu::DeviceVector<int> owner(num_particles);
+    amrex::Gpu::DeviceVector<amrex::Real> pdata(num_particles * msg_size);
+    {
+        auto* oarr = owner.data();
+        auto* parr = pdata.data();
+        int offset = 0;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+                const int np = pti.numParticles();
+                auto* pstruct = pti.GetArrayOfStructs()().data();
+
+                amrex::ParallelFor(
+                    np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        auto& pp = pstruct[ip];
+                        const int idx = offset + ip;
+                        oarr[idx] = pp.cpu();
+                        auto* buf = parr + idx * msg_size;
+                        buf[0] = static_cast<amrex::Real>(pp.idata(0));
+                        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                            buf[1 + n] = pp.rdata(n);
+                        }
+                    });
+                offset += np;
+            }
+        }
+    }
 
-                auto& vvel = varr[idx];
-                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
-                    vvel[n] = pp.rdata(n);
-                }
-            });
+    amrex::Vector<int> ownerh(num_particles);
+    amrex::Vector<amrex::Real> pdatah(num_particles * msg_size);
+    amrex::Gpu::copyAsync(
+        amrex::Gpu::deviceToHost, owner.begin(), owner.end(), ownerh.begin());
+    amrex::Gpu::copyAsync(
+        amrex::Gpu::deviceToHost, pdata.begin(), pdata.end(), pdatah.begin());
+    amrex::Gpu::streamSynchronize();
+
+    auto& vel_arr = m_data.velocity;
+    auto unpack = [&vel_arr](const amrex::Real* buf, const int npts) {
+        for (int i = 0; i < npts; ++i) {
+            const auto* pbuf = buf + i * msg_size;
+            auto& vvel = vel_arr[static_cast<int>(pbuf[0])];
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                vvel[n] = pbuf[1 + n];
+            }
+        }
+    };
+
+    // Group the particles by the rank that owns them
+    amrex::Vector<int> offsets(nprocs + 1, 0);
+    for (const int ip : ownerh) {
+        ++offsets[ip + 1];
+    }
+    for (int ip = 0; ip < nprocs; ++ip) {
+        offsets[ip + 1] += offsets[ip];
+    }
+    amrex::Vector<amrex::Real> sbuf(num_particles * msg_size);
+    {
+        amrex::Vector<int> pos(offsets.begin(), offsets.end() - 1);
+        for (int i = 0; i < num_particles; ++i) {
+            const int idx = pos[ownerh[i]]++;
+            std::copy(
+                pdatah.begin() + i * msg_size,
+                pdatah.begin() + (i + 1) * msg_size,
+                sbuf.begin() + idx * msg_size);
         }
     }
 
-    amrex::Gpu::copy(
-        amrex::Gpu::deviceToHost, vel.begin(), vel.end(), velh.begin());
+    // Points sampled on this rank do not need any communication
+    const int num_local = offsets[iproc + 1] - offsets[iproc];
+    unpack(sbuf.data() + offsets[iproc] * msg_size, num_local);
+    int num_remote = 0;
+
 #ifdef AMREX_USE_MPI
-    MPI_Allreduce(
-        MPI_IN_PLACE, &(velh[0][0]), m_proc_offsets.back() * AMREX_SPACEDIM,
-        MPI_DOUBLE, MPI_SUM, amrex::ParallelDescriptor::Communicator());
-#endif
-    {
-        auto& vel_arr = m_data.velocity;
-        const int npts = vel_arr.size();
-        const int ioff = m_proc_offsets[amrex::ParallelDescriptor::MyProc()];
-        for (int i = 0; i < npts; ++i) {
-            vel_arr[i] = velh[ioff + i];
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    const auto dtype =
+        amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+    const int tag = amrex::ParallelDescriptor::SeqNum();
+
+    amrex::Vector<MPI_Request> sreqs;
+    for (int ip = 0; ip < nprocs; ++ip) {
+        const int npts = offsets[ip + 1] - offsets[ip];
+        if ((ip == iproc) || (npts < 1)) {
+            continue;
+        }
+        sreqs.emplace_back();
+        MPI_Isend(
+            sbuf.data() + offsets[ip] * msg_size, npts * msg_size, dtype, ip,
+            tag, comm, &sreqs.back());
+    }
+
+    // Number of points sampled on other ranks that belong to this rank
+    amrex::Vector<int> send_counts(nprocs, 0);
+    for (int ip = 0; ip < nprocs; ++ip) {
+        if (ip != iproc) {
+            send_counts[ip] = offsets[ip + 1] - offsets[ip];
         }
     }
+    MPI_Reduce_scatter_block(
+        send_counts.data(), &num_remote, 1, MPI_INT, MPI_SUM, comm);
+
+    amrex::Vector<amrex::Real> rbuf;
+    int nrecv = num_remote;
+    while (nrecv > 0) {
+        MPI_Status status;
+        MPI_Probe(MPI_ANY_SOURCE, tag, comm, &status);
+        int count = 0;
+        MPI_Get_count(&status, dtype, &count);
+        rbuf.resize(count);
+        MPI_Recv(
+            rbuf.data(), count, dtype, status.MPI_SOURCE, tag, comm,
+            MPI_STATUS_IGNORE);
+
+        const int npts = count / msg_size;
+        unpack(rbuf.data(), npts);
+        nrecv -= npts;
+    }
+
+    MPI_Waitall(
+        static_cast<int>(sreqs.size()), sreqs.data(), MPI_STATUSES_IGNORE);
+#endif
+
+    if (num_local + num_remote != static_cast<int>(vel_arr.size())) {
+        amrex::Abort(
+            "ActuatorContainer: velocities were sampled at " +
+            std::to_string(num_local + num_remote) + " of the " +
+            std::to_string(vel_arr.size()) +
+            " actuator points owned by rank " + std::to_string(iproc) +
+            ". Actuator points may have been lost during Redistribute.");
+    }
 }
 
 /** Helper method for ActuatorContainer::sample_velocities
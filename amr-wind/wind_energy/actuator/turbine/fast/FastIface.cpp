@@ -45,6 +45,12 @@ FastIface::FastIface(const amr_wind::CFDSim& /*unused*/) {}
 
 FastIface::~FastIface()
 {
+    for (auto& pending : m_pending) {
+        if (pending.valid()) {
+            pending.wait();
+        }
+    }
+
     int ierr = ErrID_None;
     char err_msg[fast_strlen()];
     FAST_DeallocateTurbines(&ierr, err_msg);
@@ -111,6 +117,7 @@ int FastIface::register_turbine(FastTurbine& data)
     m_turbine_map[gid] = local_id;
     data.tid_local = local_id;
     m_turbine_data.emplace_back(&data);
+    m_pending.emplace_back();
 
     return local_id;
 }
@@ -138,24 +145,61 @@ void FastIface::advance_turbine(const int local_id)
 {
     BL_PROFILE("amr-wind::FastIface::advance_turbine");
     AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+    wait_turbine(local_id);
 
     auto& fi = *m_turbine_data[local_id];
     AMREX_ASSERT(!fi.is_solution0);
-    {
-        const auto& tmax = fi.stop_time;
-        const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
-        if (telapsed > (tmax + 1.0e-8)) {
-            // clang-format off
-            amrex::OutStream()
-                << "\nWARNING: FastIface:\n"
-                << "  Elapsed simulation time will exceed max "
-                << "time set for OpenFAST"
-                << std::endl << std::endl;
-            // clang-format on
-        }
-    }
+    check_stop_time(fi);
+    write_velocity_data(fi);
+    fast_step_turbine(fi);
+}
+
+void FastIface::advance_turbine_async(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine_async");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+    wait_turbine(local_id);
 
+    auto& fi = *m_turbine_data[local_id];
+    AMREX_ASSERT(!fi.is_solution0);
+    check_stop_time(fi);
     write_velocity_data(fi);
+
+    // The turbine data must not be accessed until wait_turbine is called
+    m_pending[local_id] = std::async(
+        std::launch::async, [this, &fi]() { fast_step_turbine(fi); });
+}
+
+void FastIface::wait_turbine(const int local_id)
+{
+    AMREX_ASSERT(local_id < static_cast<int>(m_pending.size()));
+    auto& pending = m_pending[local_id];
+    if (pending.valid()) {
+        BL_PROFILE("amr-wind::FastIface::wait_turbine");
+        pending.get();
+    }
+}
+
+void FastIface::check_stop_time(const FastTurbine& fi) const
+{
+    const auto& tmax = fi.stop_time;
+    const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
+    if (telapsed > (tmax + 1.0e-8)) {
+        // clang-format off
+        amrex::OutStream()
+            << "\nWARNING: FastIface:\n"
+            << "  Elapsed simulation time will exceed max "
+            << "time set for OpenFAST"
+            << std::endl << std::endl;
+        // clang-format on
+    }
+}
+
+void FastIface::fast_step_turbine(FastTurbine& fi)
+{
+    // This might be called from a background thread, so avoid profiling and
+    // ensure that only one turbine is advanced at a time
+    std::lock_guard<std::mutex> lock(m_fast_mutex);
     for (int i = 0; i < fi.num_substeps; ++i, ++fi.time_index) {
         fast_func(FAST_OpFM_Step, &fi.tid_local);
     }
@@ -0,0 +1,56 @@
+/** \file decompress_plt.cpp
+ *
+ *  Convert a compressed plot file (written with `io.plot_compression = true`)
+ *  into a regular AMReX plot file that can be read by the visualization and
+ *  post-processing tools. The plot files are given with the `input` and
+ *  `output` parameters, e.g.,
+ *
+ *  `amr_wind_decompress_plt input=plt00100 output=plt00100_raw`
+ */
+
+#include <string>
+
+#include "amr-wind/utilities/PlotfileCompression.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX.H"
+#include "AMReX_ParmParse.H"
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+    });
+
+    {
+        BL_PROFILE("decompress-plt::main");
+        std::string input;
+        std::string output;
+        amrex::ParmParse pp;
+        pp.get("input", input);
+        pp.get("output", output);
+
+        if (!amr_wind::plotfile::is_compressed(input)) {
+            amrex::Abort(input + " is not a compressed plot file");
+        }
+        amrex::Print() << "Decompressing " << input << " into " << output
+                       << std::endl;
+        amr_wind::plotfile::decompress(input, output);
+    }
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
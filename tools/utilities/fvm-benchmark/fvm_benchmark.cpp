@@ -0,0 +1,248 @@
+/** \file fvm_benchmark.cpp
+ *
+ *  Micro-benchmark comparing the dispatch of the finite volume stencils
+ *
+ *  The gradient, laplacian, and strain rate operators are applied repeatedly
+ *  on a single level mesh with non-periodic boundaries using one kernel launch
+ *  per stencil (interior + 26 boundary stencils) and using a single launch per
+ *  box. The mesh is controlled by the usual `amr.n_cell`, `amr.max_grid_size`,
+ *  and `geometry.is_periodic` inputs, and the number of repetitions by
+ *  `benchmark.iterations`.
+ */
+
+#include <iomanip>
+#include <string>
+
+#include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/fvm/gradient.H"
+#include "amr-wind/fvm/laplacian.H"
+#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX.H"
+#include "AMReX_AmrCore.H"
+#include "AMReX_ParmParse.H"
+
+namespace {
+
+//! Single level mesh holding the fields used in the benchmark
+class BenchmarkMesh : public amrex::AmrCore
+{
+public:
+    BenchmarkMesh() : m_repo(*this) {}
+
+    amr_wind::FieldRepo& repo() { return m_repo; }
+
+protected:
+    void MakeNewLevelFromScratch(
+        int lev,
+        amrex::Real time,
+        const amrex::BoxArray& ba,
+        const amrex::DistributionMapping& dm) override
+    {
+        SetBoxArray(lev, ba);
+        SetDistributionMap(lev, dm);
+        m_repo.make_new_level_from_scratch(lev, time, ba, dm);
+    }
+
+    void MakeNewLevelFromCoarse(
+        int /*lev*/,
+        amrex::Real /*time*/,
+        const amrex::BoxArray& /*ba*/,
+        const amrex::DistributionMapping& /*dm*/) override
+    {
+        amrex::Abort("Not implemented");
+    }
+
+    void RemakeLevel(
+        int /*lev*/,
+        amrex::Real /*time*/,
+        const amrex::BoxArray& /*ba*/,
+        const amrex::DistributionMapping& /*dm*/) override
+    {
+        amrex::Abort("Not implemented");
+    }
+
+    void ClearLevel(int lev) override { m_repo.clear_level(lev); }
+
+    void ErrorEst(
+        int /*lev*/,
+        amrex::TagBoxArray& /*tags*/,
+        amrex::Real /*time*/,
+        int /*ngrow*/) override
+    {}
+
+private:
+    amr_wind::FieldRepo m_repo;
+};
+
+void set_default_inputs()
+{
+    amrex::ParmParse pp_amr("amr");
+    if (!pp_amr.contains("n_cell")) {
+        pp_amr.addarr("n_cell", amrex::Vector<int>{{64, 64, 64}});
+    }
+    if (!pp_amr.contains("max_grid_size")) {
+        pp_amr.add("max_grid_size", 16);
+    }
+    if (!pp_amr.contains("blocking_factor")) {
+        pp_amr.add("blocking_factor", 8);
+    }
+    pp_amr.add("max_level", 0);
+
+    amrex::ParmParse pp_geom("geometry");
+    if (!pp_geom.contains("prob_lo")) {
+        pp_geom.addarr("prob_lo", amrex::Vector<amrex::Real>{{0.0, 0.0, 0.0}});
+    }
+    if (!pp_geom.contains("prob_hi")) {
+        pp_geom.addarr("prob_hi", amrex::Vector<amrex::Real>{{1.0, 1.0, 1.0}});
+    }
+    if (!pp_geom.contains("is_periodic")) {
+        pp_geom.addarr("is_periodic", amrex::Vector<int>{{0, 0, 0}});
+    }
+}
+
+void init_velocity(BenchmarkMesh& mesh, amr_wind::Field& velocity)
+{
+    const auto& geom = mesh.Geom(0);
+    const auto problo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    auto& vel = velocity(0);
+
+    for (amrex::MFIter mfi(vel); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.growntilebox();
+        const auto& varr = vel.array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                varr(i, j, k, 0) = std::sin(x) * std::cos(y) + z * z;
+                varr(i, j, k, 1) = std::cos(x) * std::sin(z) + y;
+                varr(i, j, k, 2) = x * y * z;
+            });
+    }
+}
+
+//! Time both dispatch modes for an operator and print the results
+template <typename FvmOp, typename FType>
+void run_benchmark(
+    const std::string& name,
+    const FvmOp& op,
+    const FType& fld,
+    const int niters)
+{
+    namespace impl = amr_wind::fvm::impl;
+
+    // Warm up both code paths
+    impl::apply_per_stencil(op, fld);
+    impl::apply_single_launch(op, fld);
+    amrex::Gpu::streamSynchronize();
+
+    amrex::Real t_per_stencil = amrex::ParallelDescriptor::second();
+    for (int n = 0; n < niters; ++n) {
+        impl::apply_per_stencil(op, fld);
+    }
+    amrex::Gpu::streamSynchronize();
+    t_per_stencil = amrex::ParallelDescriptor::second() - t_per_stencil;
+
+    amrex::Real t_single = amrex::ParallelDescriptor::second();
+    for (int n = 0; n < niters; ++n) {
+        impl::apply_single_launch(op, fld);
+    }
+    amrex::Gpu::streamSynchronize();
+    t_single = amrex::ParallelDescriptor::second() - t_single;
+
+    amrex::ParallelDescriptor::ReduceRealMax(t_per_stencil);
+    amrex::ParallelDescriptor::ReduceRealMax(t_single);
+
+    amrex::Print() << std::setw(12) << std::left << name << std::right
+                   << std::setw(16) << 1.0e3 * t_per_stencil / niters
+                   << std::setw(16) << 1.0e3 * t_single / niters
+                   << std::setw(12) << t_per_stencil / t_single << std::endl;
+}
+
+void run_benchmarks()
+{
+    BL_PROFILE("fvm-benchmark::run_benchmarks");
+    int niters = 100;
+    {
+        amrex::ParmParse pp("benchmark");
+        pp.query("iterations", niters);
+    }
+
+    BenchmarkMesh mesh;
+    mesh.InitFromScratch(0.0);
+
+    auto& repo = mesh.repo();
+    auto& vel = repo.declare_field("velocity", 3, 1);
+    auto& gradvel = repo.declare_field("velocity_gradient", 9, 0);
+    auto& lapvel = repo.declare_field("velocity_laplacian", 1, 0);
+    auto& strvel = repo.declare_field("velocity_strainrate", 1, 0);
+    init_velocity(mesh, vel);
+
+    int nboundary = 0;
+    const auto& domain = mesh.Geom(0).Domain();
+    for (amrex::MFIter mfi(vel(0), amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        if (!domain.strictly_contains(mfi.tilebox())) {
+            ++nboundary;
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(nboundary);
+
+    amrex::Print() << "Boxes: " << mesh.boxArray(0).size()
+                   << ", boxes (tiles) touching the boundaries: " << nboundary
+                   << ", iterations: " << niters << std::endl
+                   << std::endl
+                   << std::setw(12) << std::left << "Operator" << std::right
+                   << std::setw(16) << "Per stencil" << std::setw(16)
+                   << "Single launch" << std::setw(12) << "Speedup"
+                   << std::endl
+                   << std::setw(12) << " " << std::setw(16) << "(ms/call)"
+                   << std::setw(16) << "(ms/call)" << std::endl;
+
+    run_benchmark(
+        "gradient", amr_wind::fvm::Gradient<amr_wind::Field, amr_wind::Field>(
+                        gradvel, vel),
+        vel, niters);
+    run_benchmark(
+        "laplacian",
+        amr_wind::fvm::Laplacian<amr_wind::Field, amr_wind::Field>(
+            lapvel, vel),
+        vel, niters);
+    run_benchmark(
+        "strainrate",
+        amr_wind::fvm::StrainRate<amr_wind::Field, amr_wind::Field>(
+            strvel, vel),
+        vel, niters);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+
+        set_default_inputs();
+    });
+
+    run_benchmarks();
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
@@ -312,6 +312,63 @@ TEST_F(FieldRepoTest, scratch_fields)
     }
 }
 
+TEST_F(FieldRepoTest, scratch_field_pool)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    const auto& pool = frepo.scratch_pool();
+    const int nlevels = frepo.num_active_levels();
+
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        EXPECT_EQ(pool.stats().misses, nlevels);
+        EXPECT_EQ(pool.stats().hits, 0);
+        EXPECT_EQ(pool.stats().bytes_pooled, 0);
+        EXPECT_EQ(pool.stats().bytes_in_use, pool.stats().peak_bytes);
+    }
+    EXPECT_EQ(pool.stats().bytes_in_use, 0);
+    EXPECT_EQ(pool.stats().bytes_pooled, pool.stats().peak_bytes);
+
+    {
+        // Same layout is satisfied from the pool
+        auto sfield = frepo.create_scratch_field(3, 1);
+        EXPECT_EQ(pool.stats().hits, nlevels);
+
+        // Different layouts require new allocations
+        auto nd_field =
+            frepo.create_scratch_field(3, 1, amr_wind::FieldLoc::NODE);
+        auto cc_field = frepo.create_scratch_field(1, 1);
+        EXPECT_EQ(pool.stats().misses, 3 * nlevels);
+
+        for (int lev = 0; lev < nlevels; ++lev) {
+            (*sfield)(lev).setVal(2.0);
+            EXPECT_NEAR((*sfield)(lev).max(0), 2.0, 1.0e-12);
+        }
+    }
+
+    const auto peak = pool.stats().peak_bytes;
+    EXPECT_EQ(pool.stats().bytes_in_use, 0);
+    EXPECT_EQ(pool.stats().bytes_pooled, peak);
+
+    // Recreating a level discards the pooled data at that level
+    frepo.scratch_pool().invalidate_level(0);
+    auto sfield = frepo.create_scratch_field(3, 1);
+    EXPECT_EQ(pool.stats().hits, 2 * nlevels - 1);
+    EXPECT_EQ(pool.stats().evictions, 0);
+
+    // Pooled data in excess of the limit is freed, least recently used first
+    const auto max_bytes = pool.stats().bytes_in_use;
+    frepo.scratch_pool().set_max_pooled_bytes(max_bytes);
+    EXPECT_GT(pool.stats().evictions, 0);
+    EXPECT_LE(pool.stats().bytes_pooled, max_bytes);
+
+    sfield.reset();
+    EXPECT_LE(pool.stats().bytes_pooled, max_bytes);
+    sfield = frepo.create_scratch_field(3, 1);
+    EXPECT_EQ(pool.stats().hits, 3 * nlevels - 1);
+}
+
 TEST_F(FieldRepoTest, int_fields)
 {
     initialize_mesh();
@@ -352,6 +409,62 @@ TEST_F(FieldRepoTest, default_fillpatch_op)
     velocity.fillpatch(sim().time().current_time());
 }
 
+TEST_F(FieldRepoTest, batched_fillpatch)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    const amrex::Real time = sim().time().current_time();
+
+    amrex::Vector<amr_wind::Field*> batched;
+    amrex::Vector<amr_wind::Field*> single;
+    for (const int ncomp : {1, 3}) {
+        const std::string suffix = std::to_string(ncomp);
+        batched.push_back(&frepo.declare_field("batched" + suffix, ncomp, 2));
+        single.push_back(&frepo.declare_field("single" + suffix, ncomp, 2));
+    }
+
+    const int nfields = batched.size();
+    for (auto* fld : batched) {
+        fld->set_default_fillpatch_bc(sim().time());
+    }
+    for (auto* fld : single) {
+        fld->set_default_fillpatch_bc(sim().time());
+    }
+
+    for (int lev = 0; lev < frepo.num_active_levels(); ++lev) {
+        for (int ifld = 0; ifld < nfields; ++ifld) {
+            auto& mf = (*batched[ifld])(lev);
+            mf.setVal(0.0);
+            const auto& marrs = mf.arrays();
+            amrex::ParallelFor(
+                mf, amrex::IntVect(0), mf.nComp(),
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) {
+                    marrs[nbx](i, j, k, n) = i + 2.0 * j + 3.0 * k + n;
+                });
+            amrex::Gpu::synchronize();
+            amrex::MultiFab::Copy(
+                (*single[ifld])(lev), mf, 0, 0, mf.nComp(), mf.nGrowVect());
+        }
+    }
+
+    frepo.fillpatch(batched, time);
+    for (auto* fld : single) {
+        fld->fillpatch(time);
+    }
+
+    for (int lev = 0; lev < frepo.num_active_levels(); ++lev) {
+        for (int ifld = 0; ifld < nfields; ++ifld) {
+            auto& mf = (*single[ifld])(lev);
+            EXPECT_GT(mf.norm0(0, 2), 0.0);
+            amrex::MultiFab::Subtract(
+                mf, (*batched[ifld])(lev), 0, 0, mf.nComp(), 2);
+            for (int n = 0; n < mf.nComp(); ++n) {
+                EXPECT_NEAR(mf.norm0(n, 2), 0.0, 1.0e-12);
+            }
+        }
+    }
+}
+
 TEST_F(FieldRepoTest, field_subviews)
 {
     initialize_mesh();
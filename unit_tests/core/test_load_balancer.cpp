@@ -0,0 +1,89 @@
+/** \file test_load_balancer.cpp
+ *
+ *  Unit tests for amr_wind::LoadBalancer
+ */
+
+#include <numeric>
+
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/LoadBalancer.H"
+
+namespace amr_wind_tests {
+
+class LoadBalancerTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+        }
+        {
+            amrex::ParmParse pp("loadbalance");
+            pp.add("enabled", 1);
+            pp.add("actuator_weight", 3.0);
+        }
+    }
+};
+
+TEST_F(LoadBalancerTest, weights)
+{
+    initialize_mesh();
+    amr_wind::LoadBalancer lb(mesh());
+
+    EXPECT_TRUE(lb.enabled());
+    EXPECT_NEAR(lb.weight("actuator", 2.0), 3.0, 1.0e-12);
+    EXPECT_NEAR(lb.weight("vof", 1.0), 1.0, 1.0e-12);
+}
+
+TEST_F(LoadBalancerTest, costs)
+{
+    initialize_mesh();
+    amr_wind::LoadBalancer lb(mesh());
+
+    const auto& ba = mesh().boxArray(0);
+    const auto& dm = mesh().DistributionMap(0);
+    lb.reset_level(0, ba, dm);
+    ASSERT_EQ(ba.size(), 8);
+
+    // Without any reported work the cost of a box is its number of cells
+    const auto& costs = lb.box_costs(0);
+    ASSERT_EQ(costs.size(), ba.size());
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        EXPECT_NEAR(costs[i], 64.0, 1.0e-12);
+    }
+
+    // Work reported over two timesteps on the first box
+    amrex::LayoutData<amrex::Real> dummy(ba, dm);
+    for (int nstep = 0; nstep < 2; ++nstep) {
+        for (amrex::MFIter mfi(dummy); mfi.isValid(); ++mfi) {
+            if (mfi.index() == 0) {
+                lb.add_cost(0, mfi, 32.0 * (nstep + 1));
+            }
+        }
+        lb.end_timestep();
+    }
+
+    // The costs are updated on the next regrid of the level
+    amrex::BoxArray new_ba(ba);
+    new_ba.maxSize(2);
+    amrex::DistributionMapping new_dm(new_ba);
+    lb.reset_level(0, new_ba, new_dm);
+
+    const auto& new_costs = lb.box_costs(0);
+    ASSERT_EQ(new_costs.size(), new_ba.size());
+    const amrex::Real total =
+        std::accumulate(new_costs.begin(), new_costs.end(), 0.0);
+    EXPECT_NEAR(total, 512.0 + 48.0, 1.0e-10);
+
+    // The additional work is distributed evenly within the original box
+    for (int i = 0; i < static_cast<int>(new_ba.size()); ++i) {
+        const amrex::Real expected = ba[0].contains(new_ba[i]) ? 14.0 : 8.0;
+        EXPECT_NEAR(new_costs[i], expected, 1.0e-12);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,108 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/MeshMap.H"
+
+#include "AMReX_ParReduce.H"
+
+namespace amr_wind_tests {
+
+class MeshMapTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+        }
+        {
+            amrex::ParmParse pp("ChannelFlowMap");
+            amrex::Vector<amrex::Real> beta{{0.0, 2.0, 0.0}};
+            pp.addarr("beta", beta);
+        }
+        {
+            amrex::ParmParse pp("ConstantMap");
+            amrex::Vector<amrex::Real> fac{{1.0, 0.5, 2.0}};
+            pp.addarr("scaling_factor", fac);
+        }
+    }
+
+    std::unique_ptr<amr_wind::MeshMap> create_map(const std::string& name)
+    {
+        auto mesh_map = amr_wind::MeshMap::create(name);
+        mesh_map->declare_mapping_fields(sim(), m_nghost);
+        for (int lev = 0; lev <= mesh().finestLevel(); ++lev) {
+            mesh_map->create_map(lev, mesh().Geom(lev));
+        }
+        return mesh_map;
+    }
+
+    const int m_nghost{2};
+};
+
+TEST_F(MeshMapTest, channel_flow_map)
+{
+    constexpr double tol = 1.0e-12;
+    initialize_mesh();
+    auto& field = mesh().field_repo().declare_field("scalar", 1, m_nghost);
+    const auto mesh_map = create_map("ChannelFlowMap");
+    ASSERT_TRUE(mesh_map->is_separable());
+
+    const auto& geom = mesh().Geom(0);
+    const auto& dx = geom.CellSizeArray();
+    const auto& problo = geom.ProbLoArray();
+    const auto& probhi = geom.ProbHiArray();
+    const amrex::Real beta = 2.0;
+    const amrex::Real len = probhi[1] - problo[1];
+
+    const auto mv = mesh_map->view(0, amr_wind::FieldLoc::CELL);
+    const amrex::Real max_err = amrex::ParReduce(
+        amrex::TypeList<amrex::ReduceOpMax>{}, amrex::TypeList<amrex::Real>{},
+        field(0), amrex::IntVect(m_nghost),
+        [=] AMREX_GPU_HOST_DEVICE(int nbx, int i, int j, int k)
+            -> amrex::GpuTuple<amrex::Real> {
+            const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+            const bool in_domain = (y > problo[1]) && (y < probhi[1]);
+            const amrex::Real fac_y =
+                in_domain ? beta *
+                                (1.0 - std::pow(
+                                           std::tanh(
+                                               beta * (1.0 - 2.0 * y / len)),
+                                           2)) /
+                                std::tanh(beta)
+                          : 1.0;
+            return amrex::max(
+                std::abs(mv.fac(nbx, i, j, k, 0) - 1.0),
+                std::abs(mv.fac(nbx, i, j, k, 1) - fac_y),
+                std::abs(mv.fac(nbx, i, j, k, 2) - 1.0),
+                std::abs(mv.detJ(nbx, i, j, k) - fac_y));
+        });
+    EXPECT_NEAR(max_err, 0.0, tol);
+}
+
+TEST_F(MeshMapTest, constant_map)
+{
+    constexpr double tol = 1.0e-12;
+    initialize_mesh();
+    auto& field = mesh().field_repo().declare_nd_field("nodal", 1, 0);
+    const auto mesh_map = create_map("ConstantMap");
+    ASSERT_TRUE(mesh_map->is_separable());
+
+    const auto& dx = mesh().Geom(0).CellSizeArray();
+    const auto mv = mesh_map->view(0, amr_wind::FieldLoc::NODE);
+    const amrex::Real max_err = amrex::ParReduce(
+        amrex::TypeList<amrex::ReduceOpMax>{}, amrex::TypeList<amrex::Real>{},
+        field(0), amrex::IntVect(0),
+        [=] AMREX_GPU_HOST_DEVICE(int nbx, int i, int j, int k)
+            -> amrex::GpuTuple<amrex::Real> {
+            return amrex::max(
+                std::abs(mv.coord(nbx, i, j, k, 0) - i * dx[0]),
+                std::abs(mv.coord(nbx, i, j, k, 1) - 0.5 * j * dx[1]),
+                std::abs(mv.coord(nbx, i, j, k, 2) - 2.0 * k * dx[2]),
+                std::abs(mv.detJ(nbx, i, j, k) - 1.0));
+        });
+    EXPECT_NEAR(max_err, 0.0, tol);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,61 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/core/ScratchArena.H"
+
+namespace amr_wind_tests {
+
+class ScratchArenaTest : public AmrexTest
+{};
+
+TEST_F(ScratchArenaTest, reuse_and_growth)
+{
+    amr_wind::ScratchArena arena;
+    const amrex::Box small(amrex::IntVect(0), amrex::IntVect(7));
+    const amrex::Box large(amrex::IntVect(0), amrex::IntVect(15));
+
+    amrex::Real* ptr = nullptr;
+    {
+        auto scratch = arena.frame();
+        auto fab = scratch.fab(small, 2);
+        EXPECT_EQ(fab.box(), small);
+        EXPECT_EQ(fab.nComp(), 2);
+        ptr = fab.dataPtr();
+    }
+    const amrex::Long nbytes = arena.nbytes();
+    EXPECT_GE(
+        nbytes,
+        small.numPts() * 2 * static_cast<amrex::Long>(sizeof(amrex::Real)));
+
+    // Same requests are served from the same memory
+    {
+        auto scratch = arena.frame();
+        EXPECT_EQ(scratch.fab(small, 2).dataPtr(), ptr);
+    }
+    EXPECT_EQ(arena.nbytes(), nbytes);
+
+    // Larger requests grow the arena, and the FABs within a frame are disjoint
+    {
+        auto scratch = arena.frame();
+        auto fab1 = scratch.fab(small, 2);
+        auto fab2 = scratch.fab(large, 3);
+        fab1.setVal<amrex::RunOn::Device>(1.0);
+        fab2.setVal<amrex::RunOn::Device>(2.0);
+        EXPECT_DOUBLE_EQ(fab1.sum<amrex::RunOn::Device>(0), small.numPts());
+        EXPECT_DOUBLE_EQ(
+            fab2.sum<amrex::RunOn::Device>(0), 2.0 * large.numPts());
+    }
+    const amrex::Long grown = arena.nbytes();
+    EXPECT_GT(grown, nbytes);
+
+    // Once grown, the same sequence of requests does not allocate
+    {
+        auto scratch = arena.frame();
+        scratch.fab(small, 2);
+        scratch.fab(large, 3);
+    }
+    EXPECT_EQ(arena.nbytes(), grown);
+
+    arena.release();
+    EXPECT_EQ(arena.nbytes(), 0);
+}
+
+} // namespace amr_wind_tests
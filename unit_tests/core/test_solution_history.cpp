@@ -0,0 +1,101 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/core/SolutionHistory.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void set_order(const int order)
+{
+    amrex::ParmParse pp("history");
+    pp.add("initial_guess_order", order);
+}
+
+} // namespace
+
+class SolutionHistoryTest : public AmrexTest
+{
+protected:
+    void SetUp() override
+    {
+        AmrexTest::SetUp();
+        amrex::BoxArray ba(amrex::Box(amrex::IntVect(0), amrex::IntVect(15)));
+        ba.maxSize(8);
+        amrex::DistributionMapping dm(ba);
+        m_phi.define(ba, dm, 1, 1);
+    }
+
+    amrex::Vector<amrex::MultiFab*> phi() { return {&m_phi}; }
+
+    amrex::Vector<const amrex::MultiFab*> phi_const() { return {&m_phi}; }
+
+    amrex::MultiFab m_phi;
+};
+
+TEST_F(SolutionHistoryTest, disabled)
+{
+    amr_wind::SolutionHistory history("history");
+    EXPECT_FALSE(history.enabled());
+
+    m_phi.setVal(1.0);
+    history.push(phi_const(), 0.0);
+    EXPECT_EQ(history.size(), 0);
+    EXPECT_FALSE(history.initial_guess(phi(), 1.0));
+}
+
+TEST_F(SolutionHistoryTest, linear_extrapolation)
+{
+    set_order(1);
+    amr_wind::SolutionHistory history("history");
+    EXPECT_EQ(history.order(), 1);
+    EXPECT_FALSE(history.initial_guess(phi(), 0.0));
+
+    // Only one solution available, use it as is
+    m_phi.setVal(1.0);
+    history.push(phi_const(), 0.0);
+    ASSERT_TRUE(history.initial_guess(phi(), 1.0));
+    EXPECT_NEAR(m_phi.min(0), 1.0, 1.0e-12);
+    EXPECT_NEAR(m_phi.max(0), 1.0, 1.0e-12);
+
+    // Solutions at the same time replace the previous one
+    m_phi.setVal(2.0);
+    history.push(phi_const(), 0.5);
+    m_phi.setVal(3.0);
+    history.push(phi_const(), 0.5);
+    EXPECT_EQ(history.size(), 2);
+
+    // Non-uniform time intervals: 1 + 4 * t
+    m_phi.setVal(5.0);
+    history.push(phi_const(), 1.0);
+    EXPECT_EQ(history.size(), 2);
+    ASSERT_TRUE(history.initial_guess(phi(), 1.25, 2.0));
+    EXPECT_NEAR(m_phi.min(0), 12.0, 1.0e-12);
+    EXPECT_NEAR(m_phi.max(0), 12.0, 1.0e-12);
+
+    // Ghost cells are zeroed
+    EXPECT_NEAR(m_phi.min(0, 1), 0.0, 1.0e-12);
+
+    history.reset();
+    EXPECT_EQ(history.size(), 0);
+    EXPECT_FALSE(history.initial_guess(phi(), 1.5));
+}
+
+TEST_F(SolutionHistoryTest, quadratic_extrapolation)
+{
+    set_order(2);
+    amr_wind::SolutionHistory history("history");
+
+    // Extrapolation of t^2 is exact
+    const amrex::Vector<amrex::Real> times{{0.0, 0.5, 1.5, 2.0}};
+    for (const auto t : times) {
+        m_phi.setVal(t * t);
+        history.push(phi_const(), t);
+    }
+    EXPECT_EQ(history.size(), 3);
+
+    ASSERT_TRUE(history.initial_guess(phi(), 3.0));
+    EXPECT_NEAR(m_phi.min(0), 9.0, 1.0e-12);
+    EXPECT_NEAR(m_phi.max(0), 9.0, 1.0e-12);
+}
+
+} // namespace amr_wind_tests
@@ -1,11 +1,113 @@
 #include "gtest/gtest.h"
 #include "aw_test_utils/MeshTest.H"
+#include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
+#include "amr-wind/equation_systems/PDE.H"
+#include "amr-wind/equation_systems/AdvOp_Godunov.H"
+#include "amr-wind/equation_systems/BCOps.H"
+#include "amr-wind/equation_systems/temperature/TemperatureSource.H"
 
 namespace amr_wind_tests {
 
+/** Passive scalar with a diffusion term, solved alongside temperature to
+ *  exercise the batched scalar diffusion solves
+ */
+struct PassiveScalar : amr_wind::pde::ScalarTransport
+{
+    using MLDiffOp = amrex::MLABecLaplacian;
+    using SrcTerm = amr_wind::pde::TemperatureSource;
+
+    static std::string pde_name() { return "PassiveScalar"; }
+    static std::string var_name() { return "passive_scalar"; }
+
+    static constexpr amrex::Real default_bc_value = 0.0;
+
+    static constexpr int ndim = 1;
+    static constexpr bool multiply_rho = true;
+    static constexpr bool has_diffusion = true;
+    static constexpr bool need_nph_state = true;
+};
+
+} // namespace amr_wind_tests
+
+template class amr_wind::pde::
+    PDESystem<amr_wind_tests::PassiveScalar, amr_wind::fvm::Godunov>;
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Maximum difference between a field and a reference solution
+amrex::Real max_difference(
+    const amr_wind::Field& field, const amr_wind::ScratchField& ref)
+{
+    amrex::Real err = 0.0;
+    for (int lev = 0; lev < field.repo().num_active_levels(); ++lev) {
+        amrex::MultiFab diff(
+            field(lev).boxArray(), field(lev).DistributionMap(), 1, 0);
+        amrex::MultiFab::Copy(diff, field(lev), 0, 0, 1, 0);
+        amrex::MultiFab::Subtract(diff, ref(lev), 0, 0, 1, 0);
+        err = amrex::max(err, diff.norm0());
+    }
+    return err;
+}
+
+} // namespace
+
 class PDETest : public MeshTest
 {};
 
+class PDEBatchTest : public PDETest
+{
+protected:
+    void populate_parameters() override
+    {
+        PDETest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("geometry");
+            pp.addarr("is_periodic", amrex::Vector<int>{{1, 1, 0}});
+        }
+
+        // Temperature is fixed at the walls, the passive scalar is not
+        {
+            amrex::ParmParse pp("zlo");
+            pp.add("type", std::string("no_slip_wall"));
+            pp.add("temperature", 290.0);
+            pp.add("passive_scalar_type", std::string("zero_gradient"));
+        }
+        {
+            amrex::ParmParse pp("zhi");
+            pp.add("type", std::string("no_slip_wall"));
+            pp.add("temperature", 310.0);
+            pp.add("passive_scalar_type", std::string("zero_gradient"));
+        }
+        {
+            amrex::ParmParse pp("diffusion");
+            pp.add("mg_rtol", 1.0e-12);
+            pp.add("mg_atol", 1.0e-12);
+        }
+    }
+
+    //! Uniform temperature and a passive scalar varying linearly in z
+    void init_scalars(amr_wind::Field& temperature, amr_wind::Field& scalar)
+    {
+        temperature.setVal(300.0);
+        for (int lev = 0; lev < scalar.repo().num_active_levels(); ++lev) {
+            const auto& problo = mesh().Geom(lev).ProbLoArray();
+            const auto& dx = mesh().Geom(lev).CellSizeArray();
+            for (amrex::MFIter mfi(scalar(lev)); mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.growntilebox();
+                const auto& sarr = scalar(lev).array(mfi);
+                amrex::ParallelFor(
+                    bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        sarr(i, j, k) = problo[2] + (k + 0.5) * dx[2];
+                    });
+            }
+        }
+    }
+};
+
 TEST_F(PDETest, test_pde_create_godunov)
 {
     amrex::ParmParse pp("incflo");
@@ -40,4 +142,146 @@ TEST_F(PDETest, test_pde_create_mol)
     EXPECT_EQ(mesh().field_repo().num_fields(), 25);
 }
 
+TEST_F(PDEBatchTest, scalar_diffusion_batch_single)
+{
+    amrex::ParmParse pp("incflo");
+    pp.add("use_godunov", 1);
+
+    initialize_mesh();
+
+    auto& pde_mgr = sim().pde_manager();
+    auto& icns = pde_mgr.register_icns();
+    auto& deqn = pde_mgr.register_transport_pde("Density");
+    auto& teqn = pde_mgr.register_transport_pde("Temperature");
+    sim().create_turbulence_model();
+    for (auto& eqn : pde_mgr.scalar_eqns()) {
+        eqn->initialize();
+    }
+
+    auto& repo = sim().repo();
+    auto& temperature = teqn.fields().field;
+    repo.get_field("density").setVal(1.0);
+    teqn.fields().mueff.setVal(0.5);
+
+    // Only scalars with a diffusion term can be batched
+    EXPECT_FALSE(icns.can_batch_solve());
+    EXPECT_FALSE(deqn.can_batch_solve());
+    EXPECT_TRUE(teqn.can_batch_solve());
+
+    // Reference solution without batching
+    const amrex::Real dt = 0.1;
+    temperature.setVal(300.0);
+    teqn.solve(dt);
+    auto t_ref = repo.create_scratch_field(1, 0);
+    for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+        amrex::MultiFab::Copy((*t_ref)(lev), temperature(lev), 0, 0, 1, 0);
+    }
+    EXPECT_LT(temperature(0).min(0), 299.9);
+
+    // A single batchable scalar is not deferred
+    amr_wind::pde::ScalarDiffusionBatch batch(sim());
+    batch.setup(pde_mgr.scalar_eqns());
+    EXPECT_FALSE(batch.batched(deqn));
+    EXPECT_FALSE(batch.batched(teqn));
+
+    // Scalar loop of the predictor/corrector with batching enabled
+    temperature.setVal(300.0);
+    for (auto& eqn : pde_mgr.scalar_eqns()) {
+        if (!batch.batched(*eqn)) {
+            EXPECT_TRUE(batch.solve(dt).empty());
+        }
+        if (!batch.add(*eqn)) {
+            eqn->solve(dt);
+        }
+    }
+    EXPECT_TRUE(batch.solve(dt).empty());
+    EXPECT_EQ(batch.linear_operator(), nullptr);
+    EXPECT_EQ(max_difference(temperature, *t_ref), 0.0);
+}
+
+TEST_F(PDEBatchTest, scalar_diffusion_batch_multiple)
+{
+    amrex::ParmParse pp("incflo");
+    pp.add("use_godunov", 1);
+
+    initialize_mesh();
+
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    auto& teqn = pde_mgr.register_transport_pde("Temperature");
+    auto& seqn = pde_mgr.register_transport_pde("PassiveScalar");
+    sim().create_turbulence_model();
+    for (auto& eqn : pde_mgr.scalar_eqns()) {
+        eqn->initialize();
+    }
+
+    auto& repo = sim().repo();
+    auto& temperature = teqn.fields().field;
+    auto& scalar = seqn.fields().field;
+    repo.get_field("density").setVal(1.0);
+    teqn.fields().mueff.setVal(0.5);
+    seqn.fields().mueff.setVal(2.0);
+
+    const amrex::Real dt = 0.1;
+    const amrex::Real tol = 1.0e-8;
+
+    // Reference solution from separate solves of the two equations
+    init_scalars(temperature, scalar);
+    const amrex::Real scalar_sum = scalar(0).sum(0);
+    teqn.solve(dt);
+    seqn.solve(dt);
+    auto t_ref = repo.create_scratch_field(1, 0);
+    auto s_ref = repo.create_scratch_field(1, 0);
+    for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+        amrex::MultiFab::Copy((*t_ref)(lev), temperature(lev), 0, 0, 1, 0);
+        amrex::MultiFab::Copy((*s_ref)(lev), scalar(lev), 0, 0, 1, 0);
+    }
+
+    // The wall temperatures heat and cool the domain, while the passive
+    // scalar is conserved with zero-gradient BCs
+    EXPECT_GT(temperature(0).max(0), 300.1);
+    EXPECT_LT(temperature(0).min(0), 299.9);
+    EXPECT_NEAR(scalar(0).sum(0), scalar_sum, 1.0e-8 * scalar_sum);
+
+    amr_wind::pde::ScalarDiffusionBatch batch(sim());
+    EXPECT_EQ(batch.linear_operator(), nullptr);
+    batch.setup(pde_mgr.scalar_eqns());
+    EXPECT_TRUE(batch.batched(teqn));
+    EXPECT_TRUE(batch.batched(seqn));
+
+    init_scalars(temperature, scalar);
+    EXPECT_TRUE(batch.add(teqn));
+    EXPECT_TRUE(batch.add(seqn));
+    const auto solved = batch.solve(dt);
+    ASSERT_EQ(solved.size(), 2);
+    EXPECT_EQ(solved[0], &teqn);
+    EXPECT_EQ(solved[1], &seqn);
+    EXPECT_LT(max_difference(temperature, *t_ref), tol);
+    EXPECT_LT(max_difference(scalar, *s_ref), tol);
+
+    const auto* linop = batch.linear_operator();
+    ASSERT_NE(linop, nullptr);
+
+    // Batching the same scalars again reuses the cached linear operator
+    init_scalars(temperature, scalar);
+    EXPECT_TRUE(batch.add(teqn));
+    EXPECT_TRUE(batch.add(seqn));
+    batch.solve(dt);
+    EXPECT_EQ(batch.linear_operator(), linop);
+    EXPECT_LT(max_difference(temperature, *t_ref), tol);
+    EXPECT_LT(max_difference(scalar, *s_ref), tol);
+
+    // A different set of scalars requires a new linear operator
+    init_scalars(temperature, scalar);
+    EXPECT_TRUE(batch.add(seqn));
+    EXPECT_TRUE(batch.add(teqn));
+    batch.solve(dt);
+    EXPECT_NE(batch.linear_operator(), linop);
+    EXPECT_LT(max_difference(temperature, *t_ref), tol);
+    EXPECT_LT(max_difference(scalar, *s_ref), tol);
+
+    batch.reset();
+    EXPECT_EQ(batch.linear_operator(), nullptr);
+}
+
 } // namespace amr_wind_tests
@@ -7,6 +7,7 @@
 #include "amr-wind/fvm/laplacian.H"
 #include "amr-wind/fvm/divergence.H"
 #include "amr-wind/fvm/curvature.H"
+#include "amr-wind/fvm/fused_ops.H"
 #include "AnalyticalFunction.H"
 #include "aw_test_utils/iter_tools.H"
 #include "aw_test_utils/test_utils.H"
@@ -298,6 +299,103 @@ amrex::Real q_criterion_test_impl(amr_wind::Field& vel, const int pdegree)
     return error_total;
 }
 
+//! Strain rate and gradient of the x-velocity computed in a fused sweep
+struct FusedTestOp
+{
+    amrex::Array4<const amrex::Real> vel;
+    amrex::Array4<amrex::Real> out;
+
+    template <typename Stencil>
+    AMREX_GPU_DEVICE void
+    eval(
+        const int i,
+        const int j,
+        const int k,
+        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& idx) const noexcept
+    {
+        using Deriv = amr_wind::fvm::Derivative<Stencil>;
+        const auto grad = Deriv::gradient(vel, i, j, k, 0, idx);
+        out(i, j, k, 0) = Deriv::strainrate(vel, i, j, k, idx);
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            out(i, j, k, d + 1) = grad[d];
+        }
+    }
+};
+
+amrex::Real fused_test_impl(amr_wind::Field& vel, const int pdegree)
+{
+    const int ncoeff = (pdegree + 1) * (pdegree + 1) * (pdegree + 1);
+
+    amrex::Gpu::DeviceVector<amrex::Real> cu(ncoeff, 0.00123);
+    amrex::Gpu::DeviceVector<amrex::Real> cv(ncoeff, 0.00213);
+    amrex::Gpu::DeviceVector<amrex::Real> cw(ncoeff, 0.00346);
+
+    const auto& geom = vel.repo().mesh().Geom();
+
+    run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+        auto vel_arr = vel(lev).array(mfi);
+        const auto& bx = mfi.validbox();
+        initialize_velocity(geom[lev], bx, pdegree, cu, cv, cw, vel_arr);
+    });
+
+    auto str = amr_wind::fvm::strainrate(vel);
+    auto grad = amr_wind::fvm::gradient(vel);
+    auto fused = vel.repo().create_scratch_field(AMREX_SPACEDIM + 1, 0);
+    amr_wind::fvm::fused_apply(
+        vel, [&](const int lev, const amrex::MFIter& mfi) {
+            return FusedTestOp{
+                vel(lev).const_array(mfi), (*fused)(lev).array(mfi)};
+        });
+
+    const int nlevels = vel.repo().num_active_levels();
+    amrex::Real error_total = 0.0;
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi((*fused)(lev)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            const auto& str_arr = (*str)(lev).const_array(mfi);
+            const auto& grad_arr = (*grad)(lev).const_array(mfi);
+            const auto& fused_arr = (*fused)(lev).const_array(mfi);
+
+            amrex::Loop(bx, [=, &error_total](int i, int j, int k) noexcept {
+                error_total +=
+                    amrex::Math::abs(fused_arr(i, j, k, 0) - str_arr(i, j, k));
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    error_total += amrex::Math::abs(
+                        fused_arr(i, j, k, d + 1) - grad_arr(i, j, k, d));
+                }
+            });
+        }
+    }
+
+    return error_total;
+}
+
+//! Maximum difference between the two stencil dispatch modes for an operator
+template <typename FvmOp>
+amrex::Real dispatch_diff(
+    const FvmOp& op, const amr_wind::Field& vel, amr_wind::Field& out)
+{
+    auto ref = vel.repo().create_scratch_field(out.num_comp(), 0);
+
+    amr_wind::fvm::impl::apply_per_stencil(op, vel);
+    for (int lev = 0; lev < vel.repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Copy((*ref)(lev), out(lev), 0, 0, out.num_comp(), 0);
+    }
+    out.setVal(0.0);
+    amr_wind::fvm::impl::apply_single_launch(op, vel);
+
+    amrex::Real max_diff = 0.0;
+    for (int lev = 0; lev < vel.repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Subtract(
+            (*ref)(lev), out(lev), 0, 0, out.num_comp(), 0);
+        for (int n = 0; n < out.num_comp(); ++n) {
+            max_diff = amrex::max(max_diff, (*ref)(lev).norm0(n));
+        }
+    }
+    return max_diff;
+}
+
 } // namespace
 
 TEST_F(FvmOpTest, strainrate)
@@ -408,4 +506,79 @@ TEST_F(FvmOpTest, q_criterion)
     EXPECT_NEAR(error_total, 0.0, tol);
 }
 
+TEST_F(FvmOpTest, fused_strainrate_gradient)
+{
+
+    constexpr double tol = 1.0e-12;
+
+    populate_parameters();
+    {
+        amrex::ParmParse pp("geometry");
+        amrex::Vector<int> periodic{{0, 0, 0}};
+        pp.addarr("is_periodic", periodic);
+    }
+
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    const int ncomp = 3;
+    const int nghost = 1;
+    auto& vel = repo.declare_field("vel", ncomp, nghost);
+
+    const int pdegree = 2;
+    auto error_total = fused_test_impl(vel, pdegree);
+
+    amrex::ParallelDescriptor::ReduceRealSum(error_total);
+
+    EXPECT_NEAR(error_total, 0.0, tol);
+}
+
+TEST_F(FvmOpTest, single_launch_dispatch)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 4);
+    }
+    {
+        amrex::ParmParse pp("geometry");
+        amrex::Vector<int> periodic{{0, 1, 0}};
+        pp.addarr("is_periodic", periodic);
+    }
+
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("vel", 3, 1);
+    auto& grad = repo.declare_field("grad", 9, 0);
+    auto& lap = repo.declare_field("lap", 1, 0);
+    auto& str = repo.declare_field("str", 1, 0);
+
+    const auto& geom = repo.mesh().Geom();
+    const int pdegree = 2;
+    const int ncoeff = (pdegree + 1) * (pdegree + 1) * (pdegree + 1);
+    amrex::Gpu::DeviceVector<amrex::Real> cu(ncoeff, 0.00123);
+    amrex::Gpu::DeviceVector<amrex::Real> cv(ncoeff, 0.00213);
+    amrex::Gpu::DeviceVector<amrex::Real> cw(ncoeff, 0.00346);
+    run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+        auto vel_arr = vel(lev).array(mfi);
+        const auto& bx = mfi.validbox();
+        initialize_velocity(geom[lev], bx, pdegree, cu, cv, cw, vel_arr);
+    });
+
+    using amr_wind::Field;
+    EXPECT_EQ(
+        dispatch_diff(
+            amr_wind::fvm::Gradient<Field, Field>(grad, vel), vel, grad),
+        0.0);
+    EXPECT_EQ(
+        dispatch_diff(
+            amr_wind::fvm::Laplacian<Field, Field>(lap, vel), vel, lap),
+        0.0);
+    EXPECT_EQ(
+        dispatch_diff(
+            amr_wind::fvm::StrainRate<Field, Field>(str, vel), vel, str),
+        0.0);
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,145 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/FieldPlaneAveraging.H"
+#include "amr-wind/utilities/SecondMomentAveraging.H"
+#include "amr-wind/utilities/ThirdMomentAveraging.H"
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+namespace amr_wind_tests {
+
+class FusedPlaneAveragingTest : public MeshTest
+{
+public:
+    void test_dir(int /*dir*/);
+};
+
+namespace {
+
+void init_fields(
+    const amrex::Geometry& geom,
+    const amrex::Box& bx,
+    const amrex::Array4<amrex::Real>& velocity,
+    const amrex::Array4<amrex::Real>& temperature)
+{
+    auto xlo = geom.ProbLoArray();
+    auto xhi = geom.ProbHiArray();
+    auto dx = geom.CellSizeArray();
+
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        amrex::Real x[3];
+        amrex::Real a[3];
+
+        x[0] = xlo[0] + (i + 0.5) * dx[0];
+        x[1] = xlo[1] + (j + 0.5) * dx[1];
+        x[2] = xlo[2] + (k + 0.5) * dx[2];
+
+        for (int d = 0; d < 3; ++d) {
+            a[d] = 2.0 * amr_wind::utils::two_pi() / (xhi[d] - xlo[d]);
+        }
+
+        velocity(i, j, k, 0) = 8.0 + x[2] + std::cos(a[0] * x[0]) *
+                                                std::sin(a[1] * x[1]);
+        velocity(i, j, k, 1) = 3.0 + std::sin(a[0] * x[0] + a[2] * x[2]);
+        velocity(i, j, k, 2) =
+            0.5 * std::sin(a[1] * x[1]) * std::cos(a[2] * x[2]) +
+            0.1 * x[0];
+        temperature(i, j, k, 0) =
+            300.0 + x[2] + 0.2 * std::cos(a[1] * x[1] + a[0] * x[0]);
+    });
+}
+
+} // namespace
+
+void FusedPlaneAveragingTest::test_dir(int dir)
+{
+    constexpr double tol = 1.0e-10;
+
+    populate_parameters();
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& velocityf = frepo.declare_field("velocity", 3);
+    auto& temperaturef = frepo.declare_field("temperature");
+    auto velocity = velocityf.vec_ptrs();
+    auto temperature = temperaturef.vec_ptrs();
+
+    run_algorithm(
+        mesh().num_levels(), velocity,
+        [&](const int lev, const amrex::MFIter& mfi) {
+            auto vel = velocity[lev]->array(mfi);
+            auto temp = temperature[lev]->array(mfi);
+            const auto& bx = mfi.validbox();
+            init_fields(mesh().Geom(lev), bx, vel, temp);
+        });
+
+    // Reference values computed one quantity at a time
+    amr_wind::VelPlaneAveraging pa_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging pa_temp(temperaturef, sim().time(), dir);
+    amr_wind::SecondMomentAveraging pa_tu(pa_vel, pa_temp);
+    amr_wind::SecondMomentAveraging pa_uu(pa_vel, pa_vel);
+    amr_wind::ThirdMomentAveraging pa_uuu(pa_vel, pa_vel, pa_vel);
+    pa_vel();
+    pa_temp();
+    pa_tu();
+    pa_uu();
+    pa_uuu();
+
+    amr_wind::VelPlaneAveraging fvel(sim(), dir);
+    amr_wind::FieldPlaneAveraging ftemp(temperaturef, sim().time(), dir);
+    amr_wind::SecondMomentAveraging ftu(fvel, ftemp);
+    amr_wind::SecondMomentAveraging fuu(fvel, fvel);
+    amr_wind::ThirdMomentAveraging fuuu(fvel, fvel, fvel);
+
+    amr_wind::FusedPlaneAveraging fused;
+    fused.add(fvel);
+    fused.add(ftu);
+    fused.add(fuu);
+    fused.add(fuuu);
+    // velocity (3) + hvelmag (1) + temperature (1) + tu (3) + symmetric uu (6)
+    // + symmetric uuu (10)
+    EXPECT_EQ(fused.num_terms(), 24);
+
+    // The second call uses the averages from the first call as the shift
+    for (int it = 0; it < 2; ++it) {
+        fused();
+
+        const int ncell = pa_vel.ncell_line();
+        for (int ind = 0; ind < ncell; ++ind) {
+            for (int n = 0; n < 3; ++n) {
+                EXPECT_NEAR(
+                    fvel.line_average_cell(ind, n),
+                    pa_vel.line_average_cell(ind, n), tol);
+            }
+            EXPECT_NEAR(
+                fvel.line_hvelmag_average()[ind],
+                pa_vel.line_hvelmag_average()[ind], tol);
+            EXPECT_NEAR(
+                ftemp.line_average_cell(ind, 0),
+                pa_temp.line_average_cell(ind, 0), tol);
+            for (int n = 0; n < 3; ++n) {
+                EXPECT_NEAR(
+                    ftu.line_moment()[3 * ind + n],
+                    pa_tu.line_moment()[3 * ind + n], tol);
+            }
+            for (int n = 0; n < 9; ++n) {
+                EXPECT_NEAR(
+                    fuu.line_moment()[9 * ind + n],
+                    pa_uu.line_moment()[9 * ind + n], tol);
+            }
+            for (int n = 0; n < 27; ++n) {
+                EXPECT_NEAR(
+                    fuuu.line_moment()[27 * ind + n],
+                    pa_uuu.line_moment()[27 * ind + n], tol);
+            }
+        }
+        EXPECT_EQ(fvel.last_updated_index(), pa_vel.last_updated_index());
+    }
+}
+
+TEST_F(FusedPlaneAveragingTest, test_xdir) { test_dir(0); }
+TEST_F(FusedPlaneAveragingTest, test_ydir) { test_dir(1); }
+TEST_F(FusedPlaneAveragingTest, test_zdir) { test_dir(2); }
+
+} // namespace amr_wind_tests
@@ -0,0 +1,297 @@
+#include <fstream>
+
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/PlotfileWriter.H"
+#include "amr-wind/utilities/PlotfileCompression.H"
+
+#include "AMReX_MultiFabUtil.H"
+#include "AMReX_ParReduce.H"
+#include "AMReX_PlotFileUtil.H"
+
+namespace amr_wind_tests {
+
+class PlotfileWriterTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{16, 16, 24}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", 8);
+            pp.addarr("n_cell", ncell);
+        }
+    }
+};
+
+namespace {
+
+void init_fields(amr_wind::Field& vel, amr_wind::IntField& iblank)
+{
+    run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.growntilebox();
+        const auto& varr = vel(lev).array(mfi);
+        const auto& iarr = iblank(lev).array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                varr(i, j, k, 0) = 1.0 + i + 0.1 * j;
+                varr(i, j, k, 1) = -2.0 * j + 0.01 * k;
+                varr(i, j, k, 2) = 0.5 * i * j * k;
+                iarr(i, j, k) = (i + j + k) % 3 - 1;
+            });
+    });
+}
+
+//! Maximum difference between a plotfile component and a field component
+amrex::Real max_plt_diff(
+    amrex::PlotFileData& pf,
+    const std::string& vname,
+    const amr_wind::Field& fld,
+    const int n)
+{
+    amrex::Real max_err = 0.0;
+    for (int lev = 0; lev < fld.repo().num_active_levels(); ++lev) {
+        amrex::MultiFab data(
+            fld(lev).boxArray(), fld(lev).DistributionMap(), 1, 0);
+        data.ParallelCopy(pf.get(lev, vname));
+        const auto& darrs = data.const_arrays();
+        const auto& farrs = fld(lev).const_arrays();
+        max_err = amrex::max(
+            max_err, amrex::ParReduce(
+                         amrex::TypeList<amrex::ReduceOpMax>{},
+                         amrex::TypeList<amrex::Real>{}, data,
+                         amrex::IntVect(0),
+                         [=] AMREX_GPU_HOST_DEVICE(
+                             int nbx, int i, int j,
+                             int k) -> amrex::GpuTuple<amrex::Real> {
+                             return std::abs(
+                                 darrs[nbx](i, j, k) - farrs[nbx](i, j, k, n));
+                         }));
+    }
+    return max_err;
+}
+
+//! Size of a file in bytes
+long file_size(const std::string& fname)
+{
+    std::ifstream ifs(fname, std::ios::binary | std::ios::ate);
+    return ifs.good() ? static_cast<long>(ifs.tellg()) : 0;
+}
+
+} // namespace
+
+TEST_F(PlotfileWriterTest, matches_amrex_plotfile)
+{
+    constexpr double tol = 1.0e-15;
+    initialize_mesh();
+
+    auto& repo = mesh().field_repo();
+    auto& vel = repo.declare_field("velocity", 3, 1);
+    auto& iblank = repo.declare_int_field("iblank", 1, 1);
+    init_fields(vel, iblank);
+
+    const amrex::Vector<std::string> var_names{
+        "velocityx", "velocityy", "velocityz", "iblank"};
+    const int nlevels = repo.num_active_levels();
+    const amrex::Vector<int> istep(nlevels, 10);
+
+    // Reference plotfile written through a staging MultiFab
+    auto outfield = repo.create_scratch_field(4);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::Copy((*outfield)(lev), vel(lev), 0, 0, 3, 0);
+        amrex::MultiFab::Copy(
+            (*outfield)(lev), amrex::ToMultiFab(iblank(lev)), 0, 3, 1, 0);
+    }
+    amrex::WriteMultiLevelPlotfile(
+        "plt_reference", nlevels, outfield->vec_const_ptrs(), var_names,
+        mesh().Geom(), 1.5, istep, mesh().refRatio());
+
+    // Write the components out of order and in separate groups
+    {
+        amr_wind::PlotfileWriter writer(
+            mesh(), "plt_streamed", var_names, nlevels, 1.5, istep, 2);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            writer.write(lev, iblank(lev), 0, 3, 1);
+            writer.write(lev, vel(lev), 1, 1, 2);
+            writer.write(lev, vel(lev), 0, 0, 1);
+        }
+        writer.finalize();
+    }
+
+    amrex::PlotFileData pf_ref("plt_reference");
+    amrex::PlotFileData pf_str("plt_streamed");
+    EXPECT_EQ(pf_str.finestLevel(), pf_ref.finestLevel());
+    EXPECT_NEAR(pf_str.time(), pf_ref.time(), tol);
+    ASSERT_EQ(pf_str.varNames().size(), var_names.size());
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_EQ(pf_str.boxArray(lev), pf_ref.boxArray(lev));
+        for (const auto& vname : var_names) {
+            auto ref = pf_ref.get(lev, vname);
+            auto str = pf_str.get(lev, vname);
+            amrex::MultiFab::Subtract(str, ref, 0, 0, 1, 0);
+            EXPECT_NEAR(str.norm0(), 0.0, tol) << vname;
+        }
+    }
+}
+
+TEST_F(PlotfileWriterTest, single_precision)
+{
+    constexpr amrex::Real ftol = 1.0e-6;
+    initialize_mesh();
+
+    auto& repo = mesh().field_repo();
+    auto& vel = repo.declare_field("velocity", 3, 1);
+    auto& iblank = repo.declare_int_field("iblank", 1, 1);
+    init_fields(vel, iblank);
+
+    const amrex::Vector<std::string> var_names{
+        "velocityx", "velocityy", "velocityz"};
+    const int nlevels = repo.num_active_levels();
+    const amrex::Vector<int> istep(nlevels, 10);
+    {
+        amr_wind::PlotfileWriter writer(
+            mesh(), "plt_single", var_names, nlevels, 1.5, istep, 1, true);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            writer.write(lev, vel(lev), 0, 0, 3);
+        }
+        writer.finalize();
+    }
+
+    amrex::PlotFileData pf("plt_single");
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (int n = 0; n < 3; ++n) {
+            amrex::MultiFab data(
+                vel(lev).boxArray(), vel(lev).DistributionMap(), 1, 0);
+            data.ParallelCopy(pf.get(lev, var_names[n]));
+            const auto& farrs = data.const_arrays();
+            const auto& varrs = vel(lev).const_arrays();
+            const amrex::Real max_err = amrex::ParReduce(
+                amrex::TypeList<amrex::ReduceOpMax>{},
+                amrex::TypeList<amrex::Real>{}, data, amrex::IntVect(0),
+                [=] AMREX_GPU_HOST_DEVICE(int nbx, int i, int j, int k)
+                    -> amrex::GpuTuple<amrex::Real> {
+                    const amrex::Real val = varrs[nbx](i, j, k, n);
+                    return std::abs(farrs[nbx](i, j, k) - val) /
+                           amrex::max(1.0, std::abs(val));
+                });
+            EXPECT_LE(max_err, ftol) << var_names[n];
+        }
+    }
+}
+
+TEST_F(PlotfileWriterTest, compress_values)
+{
+    constexpr amrex::Real tol = 1.0e-3;
+    const amrex::Vector<amrex::Real> vals{
+        0.0, 1.0, 1.0, -2.5, 1.0e-7, 3.14159, 1.0e10, 1.0e300, -0.0, 42.0};
+    const auto npts = static_cast<amrex::Long>(vals.size());
+
+    for (const bool single : {false, true}) {
+        std::vector<char> buf;
+        amrex::Vector<amrex::Real> out(npts);
+
+        // Lossless compression recovers the (rounded) values exactly
+        amr_wind::plotfile::encode(vals.data(), npts, 0.0, single, buf);
+        amr_wind::plotfile::decode(
+            buf.data(), static_cast<amrex::Long>(buf.size()), npts, 0.0,
+            single, out.data());
+        for (int i = 0; i < npts; ++i) {
+            const amrex::Real ref =
+                single ? static_cast<float>(vals[i]) : vals[i];
+            EXPECT_EQ(out[i], ref) << i;
+        }
+
+        // Values that cannot be quantized fall back to lossless compression
+        buf.clear();
+        amr_wind::plotfile::encode(vals.data(), npts, tol, single, buf);
+        amr_wind::plotfile::decode(
+            buf.data(), static_cast<amrex::Long>(buf.size()), npts, tol,
+            single, out.data());
+        for (int i = 0; i < npts; ++i) {
+            const amrex::Real ref =
+                single ? static_cast<float>(vals[i]) : vals[i];
+            EXPECT_EQ(out[i], ref) << i;
+        }
+
+        // Quantized values are within the tolerance
+        const auto nq = npts - 3;
+        buf.clear();
+        amr_wind::plotfile::encode(vals.data(), nq, tol, single, buf);
+        EXPECT_LT(static_cast<amrex::Long>(buf.size()), nq * 4);
+        amr_wind::plotfile::decode(
+            buf.data(), static_cast<amrex::Long>(buf.size()), nq, tol, single,
+            out.data());
+        for (int i = 0; i < nq; ++i) {
+            EXPECT_LE(std::abs(out[i] - vals[i]), tol * (1.0 + 1.0e-12)) << i;
+        }
+    }
+}
+
+TEST_F(PlotfileWriterTest, compressed_round_trip)
+{
+    constexpr amrex::Real tol = 1.0e-3;
+    initialize_mesh();
+
+    auto& repo = mesh().field_repo();
+    auto& vel = repo.declare_field("velocity", 3, 1);
+    auto& iblank = repo.declare_int_field("iblank", 1, 1);
+    init_fields(vel, iblank);
+
+    const amrex::Vector<std::string> var_names{
+        "velocityx", "velocityy", "velocityz", "iblank"};
+    const int nlevels = repo.num_active_levels();
+    const amrex::Vector<int> istep(nlevels, 10);
+
+    // Only the first velocity component is lossy
+    for (const auto& tols :
+         {amrex::Vector<amrex::Real>{},
+          amrex::Vector<amrex::Real>{tol, 0.0, 0.0, 0.0}}) {
+        const std::string plt_name =
+            tols.empty() ? "plt_uncompressed" : "plt_compressed";
+        amr_wind::PlotfileWriter writer(
+            mesh(), plt_name, var_names, nlevels, 1.5, istep, 1, false, tols);
+        EXPECT_EQ(writer.compressed(), !tols.empty());
+        for (int lev = 0; lev < nlevels; ++lev) {
+            writer.write(lev, vel(lev), 1, 1, 2);
+            writer.write(lev, iblank(lev), 0, 3, 1);
+            writer.write(lev, vel(lev), 0, 0, 1);
+        }
+        writer.finalize();
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    EXPECT_FALSE(amr_wind::plotfile::is_compressed("plt_uncompressed"));
+    ASSERT_TRUE(amr_wind::plotfile::is_compressed("plt_compressed"));
+    EXPECT_LT(
+        file_size("plt_compressed/Level_0/Cell_Z_D_00000"),
+        file_size("plt_uncompressed/Level_0/Cell_D_00000"));
+
+    amr_wind::plotfile::decompress("plt_compressed", "plt_decompressed");
+    amrex::PlotFileData pf("plt_decompressed");
+    EXPECT_EQ(pf.finestLevel(), nlevels - 1);
+    EXPECT_EQ(pf.time(), 1.5);
+    ASSERT_EQ(pf.varNames().size(), var_names.size());
+
+    EXPECT_LE(max_plt_diff(pf, "velocityx", vel, 0), tol * (1.0 + 1.0e-12));
+    EXPECT_EQ(max_plt_diff(pf, "velocityy", vel, 1), 0.0);
+    EXPECT_EQ(max_plt_diff(pf, "velocityz", vel, 2), 0.0);
+
+    // The integer field is compressed losslessly
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab ref(
+            iblank(lev).boxArray(), iblank(lev).DistributionMap(), 1, 0);
+        amrex::MultiFab::Copy(ref, amrex::ToMultiFab(iblank(lev)), 0, 0, 1, 0);
+        amrex::MultiFab data(ref.boxArray(), ref.DistributionMap(), 1, 0);
+        data.ParallelCopy(pf.get(lev, "iblank"));
+        amrex::MultiFab::Subtract(data, ref, 0, 0, 1, 0);
+        EXPECT_EQ(data.norm0(), 0.0);
+    }
+}
+
+} // namespace amr_wind_tests
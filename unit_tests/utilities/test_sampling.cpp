@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
 #include "amr-wind/utilities/sampling/PlaneSampler.H"
+#include "amr-wind/utilities/sampling/LidarSampler.H"
 
 namespace amr_wind_tests {
 
@@ -57,6 +58,12 @@ protected:
             num_total_particles() * var_names().size(), 0.0);
         sampling_container().populate_buffer(buf);
     }
+
+public:
+    amr_wind::sampling::SamplingContainer& container()
+    {
+        return sampling_container();
+    }
 };
 
 } // namespace
@@ -120,6 +127,54 @@ void test_scontainer_impl(
     amrex::Gpu::streamSynchronize();
 }
 
+//! Maximum distance between particles of a sampler and its locations
+amrex::Real max_position_error(
+    amr_wind::sampling::SamplingContainer& sc,
+    const int sid,
+    const amr_wind::sampling::SamplerBase::SampleLocType& locs,
+    int& nfound)
+{
+    using IIx = amr_wind::sampling::IIx;
+    const int npts = locs.size();
+    amrex::Gpu::DeviceVector<amrex::Real> dlocs(npts * AMREX_SPACEDIM);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, &locs[0][0],
+        &locs[0][0] + npts * AMREX_SPACEDIM, dlocs.begin());
+    const auto* dpos = dlocs.data();
+
+    amrex::Real max_err = 0.0;
+    nfound = 0;
+    for (amr_wind::sampling::SamplingContainer::ParIterType pti(sc, 0);
+         pti.isValid(); ++pti) {
+        const int np = pti.numParticles();
+        const auto* pstruct = pti.GetArrayOfStructs()().data();
+
+        amrex::ReduceOps<amrex::ReduceOpMax, amrex::ReduceOpSum> reduce_op;
+        amrex::ReduceData<amrex::Real, int> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        reduce_op.eval(
+            np, reduce_data,
+            [=] AMREX_GPU_DEVICE(const int ip) noexcept -> ReduceTuple {
+                const auto& pp = pstruct[ip];
+                if (pp.idata(IIx::sid) != sid) {
+                    return {0.0, 0};
+                }
+                const int idx = pp.idata(IIx::nid) * AMREX_SPACEDIM;
+                amrex::Real err = 0.0;
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    err = amrex::max(err, std::abs(pp.pos(n) - dpos[idx + n]));
+                }
+                return {err, 1};
+            });
+        const auto rv = reduce_data.value();
+        max_err = amrex::max(max_err, amrex::get<0>(rv));
+        nfound += amrex::get<1>(rv);
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(max_err);
+    amrex::ParallelDescriptor::ReduceIntSum(nfound);
+    return max_err;
+}
+
 } // namespace
 
 TEST_F(SamplingTest, scontainer)
@@ -220,6 +275,79 @@ TEST_F(SamplingTest, sampling)
     probes.post_advance_work();
 }
 
+TEST_F(SamplingTest, sampling_incremental_update)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    init_field(vel);
+
+    {
+        amrex::ParmParse pp("sampling");
+        pp.add("output_frequency", 1);
+        pp.addarr("labels", amrex::Vector<std::string>{"line1", "lidar1"});
+        pp.addarr("fields", amrex::Vector<std::string>{"velocity"});
+    }
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("type", std::string("LineSampler"));
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+    }
+    {
+        amrex::ParmParse pp("sampling.lidar1");
+        pp.add("type", std::string("LidarSampler"));
+        pp.add("num_points", 8);
+        pp.add("length", 40.0);
+        pp.addarr("origin", amrex::Vector<amrex::Real>{64.0, 64.0, 64.0});
+        pp.addarr("time_table", amrex::Vector<amrex::Real>{0.0, 10.0});
+        pp.addarr("azimuth_table", amrex::Vector<amrex::Real>{0.0, 90.0});
+        pp.addarr("elevation_table", amrex::Vector<amrex::Real>{0.0, 0.0});
+    }
+
+    SamplingImpl probes(sim(), "sampling");
+    probes.initialize();
+    const auto* sc_ptr = &probes.container();
+    const int npts = 16 + 8;
+    ASSERT_EQ(probes.num_total_particles(), static_cast<size_t>(npts));
+
+    // Container must be reused across output steps when the number of
+    // sampling locations is unchanged
+    probes.post_advance_work();
+    probes.post_advance_work();
+    EXPECT_EQ(sc_ptr, &probes.container());
+
+    amrex::Long total_particles = 0;
+    for (amr_wind::sampling::SamplingContainer::ParIterType pti(
+             probes.container(), 0);
+         pti.isValid(); ++pti) {
+        total_particles += pti.numParticles();
+    }
+    amrex::ParallelDescriptor::ReduceLongSum(total_particles);
+    EXPECT_EQ(total_particles, npts);
+
+    // Rotate the lidar beam, its particles must be moved to the new locations
+    sim().time().current_time() = 5.0;
+    probes.post_advance_work();
+    EXPECT_EQ(sc_ptr, &probes.container());
+
+    amr_wind::sampling::LidarSampler lidar(sim());
+    lidar.initialize("sampling.lidar1");
+    amr_wind::sampling::SamplerBase::SampleLocType locs;
+    lidar.sampling_locations(locs);
+    ASSERT_EQ(locs.size(), 8);
+
+    // The beam must have actually moved from its initial (x-aligned) position
+    EXPECT_GT(std::abs(locs[7][1] - 64.0), 1.0);
+
+    int nfound = 0;
+    const amrex::Real max_err =
+        max_position_error(probes.container(), 1, locs, nfound);
+    EXPECT_EQ(nfound, 8);
+    EXPECT_NEAR(max_err, 0.0, 1.0e-12);
+}
+
 TEST_F(SamplingTest, plane_sampler)
 {
     initialize_mesh();
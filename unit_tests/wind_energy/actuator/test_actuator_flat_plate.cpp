@@ -10,6 +10,7 @@
 #include "amr-wind/wind_energy/actuator/wing/ActuatorWing.H"
 #include "amr-wind/wind_energy/actuator/wing/wing_ops.H"
 #include "amr-wind/core/gpu_utils.H"
+#include "amr-wind/core/field_ops.H"
 #include "amr-wind/core/vs/vector_space.H"
 #include "amr-wind/utilities/trig_ops.H"
 
@@ -281,4 +282,66 @@ TEST_F(ActFlatPlateTest, flat_plate_init)
     act.pre_init_actions();
     act.post_init_actions();
 }
+
+TEST_F(ActFlatPlateTest, flat_plate_binned_spreading)
+{
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 3);
+    auto& src_ref = sim().repo().declare_field("src_ref", 3, 0);
+    vel.setVal(10.0, 0, 1, 3);
+
+    amrex::Vector<std::string> actuators{"T1", "T2"};
+    {
+        amrex::ParmParse pp("Actuator");
+        pp.addarr("labels", actuators);
+        pp.add("type", std::string("FlatPlateLine"));
+    }
+    {
+        amrex::ParmParse pp("Actuator.FlatPlateLine");
+        pp.add("num_points", 11);
+        pp.addarr("epsilon", amrex::Vector<amrex::Real>{1.0, 1.0, 1.0});
+        pp.add("pitch", 6.0);
+    }
+    {
+        for (int i = 0; i < 2; ++i) {
+            amrex::Real zloc = 8.0 + 16.0 * i;
+            amrex::ParmParse pp("Actuator." + actuators[i]);
+            pp.addarr("start", amrex::Vector<amrex::Real>{16.0, 12.0, zloc});
+            pp.addarr("end", amrex::Vector<amrex::Real>{16.0, 20.0, zloc});
+        }
+    }
+
+    // Reference source term computed by looping over all actuator points
+    {
+        amr_wind::actuator::ActuatorContainer::ParticleType::NextID(1U);
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+    auto& act_src = sim().repo().get_field("actuator_src_term");
+    amr_wind::field_ops::copy(src_ref, act_src, 0, 0, 3, 0);
+
+    // The Gaussian kernel is truncated at 4 epsilon, so binned spreading with
+    // the same cutoff must reproduce the reference source term
+    {
+        amrex::ParmParse pp("Actuator.FlatPlateLine");
+        pp.add("spreading_cutoff", 4.0);
+    }
+    {
+        amr_wind::actuator::ActuatorContainer::ParticleType::NextID(1U);
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+
+    const int nlevels = sim().repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            const amrex::Real ref_max = src_ref(lev).norm0(i);
+            EXPECT_GT(ref_max, 0.0);
+            amrex::MultiFab::Subtract(src_ref(lev), act_src(lev), i, i, 1, 0);
+            EXPECT_NEAR(src_ref(lev).norm0(i), 0.0, 1.0e-12 * ref_max);
+        }
+    }
+}
 } // namespace amr_wind_tests
@@ -0,0 +1,73 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/wind_energy/actuator/turbine/fast/FastIface.H"
+
+#include <chrono>
+
+namespace amr_wind_tests {
+namespace {
+
+class FastStubTest : public MeshTest
+{
+protected:
+    void TearDown() override
+    {
+        ::exw_fast::FastStub::step_cost_ms() = 0;
+        MeshTest::TearDown();
+    }
+
+    static void init_turbine(::exw_fast::FastTurbine& fi)
+    {
+        fi.tlabel = "T001";
+        fi.tid_local = -1;
+        fi.tid_global = 0;
+        fi.dt_cfd = 0.0625;
+        fi.dt_fast = 0.00625;
+        fi.num_substeps = 10;
+        fi.stop_time = 10.0;
+        fi.is_solution0 = false;
+    }
+};
+
+} // namespace
+
+TEST_F(FastStubTest, async_advance)
+{
+    initialize_mesh();
+    using clock = std::chrono::steady_clock;
+    constexpr int step_cost = 10;
+    ::exw_fast::FastStub::step_cost_ms() = step_cost;
+    const long nsteps0 = ::exw_fast::FastStub::num_steps();
+
+    ::exw_fast::FastTurbine fi;
+    init_turbine(fi);
+    ::exw_fast::FastIface fast(sim());
+    fast.register_turbine(fi);
+
+    // Synchronous advance blocks until all the substeps are complete
+    fast.advance_turbine(fi.tid_local);
+    EXPECT_EQ(fi.time_index, 10);
+    EXPECT_EQ(::exw_fast::FastStub::num_steps() - nsteps0, 10);
+
+    // Asynchronous advance returns before the substeps are complete
+    const auto start = clock::now();
+    fast.advance_turbine_async(fi.tid_local);
+    const auto launch = clock::now() - start;
+    EXPECT_LT(
+        std::chrono::duration_cast<std::chrono::milliseconds>(launch).count(),
+        fi.num_substeps * step_cost);
+
+    fast.wait_turbine(fi.tid_local);
+    const auto total = clock::now() - start;
+    EXPECT_GE(
+        std::chrono::duration_cast<std::chrono::milliseconds>(total).count(),
+        fi.num_substeps * step_cost);
+    EXPECT_EQ(fi.time_index, 20);
+    EXPECT_EQ(::exw_fast::FastStub::num_steps() - nsteps0, 20);
+
+    // Waiting without a pending advance is a no-op
+    fast.wait_turbine(fi.tid_local);
+    EXPECT_EQ(fi.time_index, 20);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,276 @@
+#include <cmath>
+#include <sstream>
+
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/wind_energy/ABLBoundaryPlane.H"
+#include "amr-wind/boundary_conditions/BCInterface.H"
+#include "amr-wind/core/FieldFillPatchOps.H"
+#include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Mesh refined with user-defined refinement criteria
+class InflowRefineMesh : public AmrTestMesh
+{
+public:
+    amrex::Vector<std::unique_ptr<amr_wind::RefinementCriteria>>&
+    refine_criteria_vec()
+    {
+        return m_refine_crit;
+    }
+
+protected:
+    void ErrorEst(
+        int lev, amrex::TagBoxArray& tags, amrex::Real time, int ngrow) override
+    {
+        for (auto& ref : m_refine_crit) {
+            (*ref)(lev, tags, time, ngrow);
+        }
+    }
+
+private:
+    amrex::Vector<std::unique_ptr<amr_wind::RefinementCriteria>> m_refine_crit;
+};
+
+//! Inflow velocity, linear in the directions tangential to the xlo boundary
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE amrex::Real inflow_velocity(
+    const amrex::Real y,
+    const amrex::Real z,
+    const int n,
+    const amrex::Real offset)
+{
+    return 1.0 + 0.1 * y + 0.2 * z + n + offset;
+}
+
+/** Maximum error in the xlo boundary ghost cells of a MultiFab
+ *
+ *  Only the ghost cells of the boxes adjacent to the boundary, within the
+ *  extents of the boxes, are checked.
+ */
+amrex::Real max_inflow_error(
+    const amrex::Geometry& geom,
+    const amrex::MultiFab& mfab,
+    const amrex::Real offset,
+    int& ncells)
+{
+    const auto problo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    const int ilo = geom.Domain().smallEnd(0);
+
+    amrex::Real max_err = 0.0;
+    ncells = 0;
+    for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+        const auto& vbx = mfi.validbox();
+        if (vbx.smallEnd(0) != ilo) {
+            continue;
+        }
+        amrex::Box bx(vbx);
+        bx.setSmall(0, ilo - 1);
+        bx.setBig(0, ilo - 1);
+
+        const auto& arr = mfab.const_array(mfi);
+        amrex::ReduceOps<amrex::ReduceOpMax, amrex::ReduceOpSum> reduce_op;
+        amrex::ReduceData<amrex::Real, int> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        reduce_op.eval(
+            bx, reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                amrex::Real err = 0.0;
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    err = amrex::max(
+                        err, std::abs(
+                                 arr(i, j, k, n) -
+                                 inflow_velocity(y, z, n, offset)));
+                }
+                return {err, 1};
+            });
+        const auto rv = reduce_data.value();
+        max_err = amrex::max(max_err, amrex::get<0>(rv));
+        ncells += amrex::get<1>(rv);
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(max_err);
+    amrex::ParallelDescriptor::ReduceIntSum(ncells);
+    return max_err;
+}
+
+} // namespace
+
+class ABLBoundaryPlaneTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{16, 16, 16}};
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{16.0, 16.0, 16.0}};
+            amrex::Vector<int> periodic{{0, 1, 1}};
+
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+            pp.addarr("is_periodic", periodic);
+        }
+        {
+            amrex::ParmParse pp("xlo");
+            pp.add("type", std::string("mass_inflow"));
+        }
+        {
+            amrex::ParmParse pp("xhi");
+            pp.add("type", std::string("pressure_outflow"));
+        }
+        {
+            amrex::ParmParse pp("ABL");
+            amrex::Vector<std::string> planes{"xlo"};
+            amrex::Vector<std::string> var_names{"velocity"};
+            pp.add("bndry_output_format", std::string("netcdf"));
+            pp.addarr("bndry_planes", planes);
+            pp.addarr("bndry_var_names", var_names);
+        }
+    }
+
+    /** Create a new mesh and the velocity field
+     *
+     *  With max_level = 1 the mesh is refined in a region adjacent to the
+     *  xlo boundary.
+     */
+    amr_wind::Field& create_mesh(const int max_level)
+    {
+        m_mesh.reset();
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_level", max_level);
+        }
+        create_mesh_instance<InflowRefineMesh>();
+
+        if (max_level > 0) {
+            std::stringstream ss;
+            ss << "1 // Number of levels" << std::endl;
+            ss << "1 // Number of boxes at this level" << std::endl;
+            ss << "0.0 6.0 6.0 4.0 10.0 10.0" << std::endl;
+            std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+                new amr_wind::CartBoxRefinement(sim()));
+            box_refine->read_inputs(mesh(), ss);
+            mesh<InflowRefineMesh>()->refine_criteria_vec().push_back(
+                std::move(box_refine));
+        }
+        initialize_mesh();
+
+        auto& velocity = sim().repo().declare_field("velocity", 3, 1);
+        velocity.register_fill_patch_op<
+            amr_wind::FieldFillPatchOps<amr_wind::FieldBCNoOp>>(
+            mesh(), time(), 0);
+        amr_wind::BCVelocity bc(velocity);
+        bc(0.0);
+        return velocity;
+    }
+
+    //! Velocity field, the fine levels are shifted by an offset
+    void init_velocity(amr_wind::Field& velocity, const amrex::Real offset)
+    {
+        for (int lev = 0; lev < mesh().num_levels(); ++lev) {
+            const auto problo = mesh().Geom(lev).ProbLoArray();
+            const auto dx = mesh().Geom(lev).CellSizeArray();
+            const amrex::Real lev_offset = (lev > 0) ? offset : 0.0;
+            for (amrex::MFIter mfi(velocity(lev)); mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.growntilebox();
+                const auto& varr = velocity(lev).array(mfi);
+                amrex::ParallelFor(
+                    bx, AMREX_SPACEDIM,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                        const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                        const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                        varr(i, j, k, n) = inflow_velocity(y, z, n, lev_offset);
+                    });
+            }
+        }
+    }
+
+    //! Write the inflow planes at two times
+    void write_planes(const std::string& fname)
+    {
+        {
+            amrex::ParmParse pp("ABL");
+            pp.add("bndry_io_mode", 0);
+            pp.add("bndry_file", fname);
+        }
+        amr_wind::ABLBoundaryPlane bndry(sim());
+        bndry.initialize_data();
+        bndry.write_header();
+        for (int i = 0; i < 2; ++i) {
+            time().set_restart_time(i, static_cast<amrex::Real>(i));
+            bndry.write_file();
+        }
+        time().set_restart_time(0, 0.0);
+    }
+
+    //! Read the inflow planes and populate the velocity ghost cells
+    void read_planes(const std::string& fname, amr_wind::Field& velocity)
+    {
+        {
+            amrex::ParmParse pp("ABL");
+            pp.add("bndry_io_mode", 1);
+            pp.add("bndry_file", fname);
+        }
+        amr_wind::ABLBoundaryPlane bndry(sim());
+        bndry.initialize_data();
+        bndry.read_header();
+        bndry.read_file();
+
+        for (int lev = 0; lev < mesh().num_levels(); ++lev) {
+            velocity(lev).setVal(0.0);
+            bndry.populate_data(lev, 0.0, velocity, velocity(lev));
+        }
+    }
+};
+
+TEST_F(ABLBoundaryPlaneTest, multilevel_inflow)
+{
+    populate_parameters();
+    const amrex::Real fine_offset = 10.0;
+    const amrex::Real tol = 1.0e-12;
+    int ncells = 0;
+
+    // Inflow file with level 0 data only
+    {
+        auto& velocity = create_mesh(0);
+        init_velocity(velocity, 0.0);
+        write_planes("abl_bndry_lev0.nc");
+    }
+
+    // Inflow file with data on a fine level touching the boundary, which
+    // differs from the level 0 data
+    auto& velocity = create_mesh(1);
+    ASSERT_EQ(mesh().num_levels(), 2);
+    init_velocity(velocity, fine_offset);
+    write_planes("abl_bndry_lev1.nc");
+
+    // Data for both levels is read back from the file
+    read_planes("abl_bndry_lev1.nc", velocity);
+    EXPECT_NEAR(
+        max_inflow_error(mesh().Geom(0), velocity(0), 0.0, ncells), 0.0, tol);
+    EXPECT_EQ(ncells, 16 * 16);
+    EXPECT_NEAR(
+        max_inflow_error(mesh().Geom(1), velocity(1), fine_offset, ncells),
+        0.0, tol);
+    EXPECT_GT(ncells, 0);
+
+    // Without fine level data in the file, the fine level is interpolated
+    // from the level 0 data (exact for a linear profile)
+    read_planes("abl_bndry_lev0.nc", velocity);
+    EXPECT_NEAR(
+        max_inflow_error(mesh().Geom(1), velocity(1), 0.0, ncells), 0.0, tol);
+    EXPECT_GT(ncells, 0);
+}
+
+} // namespace amr_wind_tests
@@ -14,6 +14,7 @@
 #include "amr-wind/equation_systems/icns/source_terms/CoriolisForcing.H"
 #include "amr-wind/equation_systems/icns/source_terms/BoussinesqBuoyancy.H"
 #include "amr-wind/equation_systems/icns/source_terms/DensityBuoyancy.H"
+#include "amr-wind/equation_systems/temperature/temperature.H"
 
 namespace amr_wind_tests {
 
@@ -490,4 +491,258 @@ TEST_F(ABLMeshTest, densitybuoyancy)
     EXPECT_NEAR(utils::field_max(src_term, 2), -9.81 * (1.0 - 1.0 / 0.5), tol);
 }
 
+TEST_F(ABLMeshTest, fused_source_forms)
+{
+    constexpr int kdim = 7;
+    constexpr amrex::Real tol = 1.0e-12;
+
+    utils::populate_abl_params();
+    initialize_mesh();
+
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    pde_mgr.register_transport_pde("Temperature");
+    sim().init_physics();
+
+    amr_wind::pde::icns::BoussinesqBuoyancy bb(sim());
+    amr_wind::pde::icns::CoriolisForcing coriolis(sim());
+    EXPECT_EQ(bb.fused_num_inputs(), 1);
+    EXPECT_EQ(coriolis.fused_num_inputs(), 1);
+
+    const auto fstate = amr_wind::FieldState::New;
+    auto& src_term = pde_mgr.icns().fields().src_term;
+    auto& velocity = sim().repo().get_field("velocity");
+    auto& temperature = sim().repo().get_field("temperature");
+    auto fused = sim().repo().create_scratch_field(AMREX_SPACEDIM);
+
+    src_term.setVal(0.0);
+    run_algorithm(src_term, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto bx = mfi.validbox();
+        const auto& vel_arr = velocity(lev).array(mfi);
+        const auto& src_arr = src_term(lev).array(mfi);
+        const auto& fused_arr = (*fused)(lev).array(mfi);
+
+        init_abl_temperature_field(kdim, bx, temperature(lev).array(mfi));
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                vel_arr(i, j, k, 0) = 10.0 + 0.1 * i - 0.2 * k;
+                vel_arr(i, j, k, 1) = -5.0 + 0.3 * j;
+                vel_arr(i, j, k, 2) = 0.5 * k - 0.1 * i;
+            });
+
+        bb(lev, mfi, bx, fstate, src_arr);
+        coriolis(lev, mfi, bx, fstate, src_arr);
+
+        amr_wind::pde::FusedSource form;
+        bb.add_fused_form(lev, mfi, fstate, form);
+        coriolis.add_fused_form(lev, mfi, fstate, form);
+        amrex::ParallelFor(
+            bx, AMREX_SPACEDIM,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                fused_arr(i, j, k, n) = form(i, j, k, n);
+            });
+    });
+
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Subtract(
+            (*fused)(lev), src_term(lev), 0, 0, AMREX_SPACEDIM, 0);
+        EXPECT_NEAR((*fused)(lev).norm0(0), 0.0, tol);
+        EXPECT_NEAR((*fused)(lev).norm0(1), 0.0, tol);
+        EXPECT_NEAR((*fused)(lev).norm0(2), 0.0, tol);
+    }
+}
+
+namespace {
+
+//! Temperature source with a fused form: 2 - 0.5 (T - 300)
+class FusedTempSrc
+    : public amr_wind::pde::TemperatureSource::Register<FusedTempSrc>
+{
+public:
+    static std::string identifier() { return "FusedTempSrc"; }
+
+    explicit FusedTempSrc(const amr_wind::CFDSim& sim)
+        : m_temperature(sim.repo().get_field("temperature"))
+    {}
+
+    void operator()(
+        const int lev,
+        const amrex::MFIter& mfi,
+        const amrex::Box& bx,
+        const amr_wind::FieldState fstate,
+        const amrex::Array4<amrex::Real>& src_term) const override
+    {
+        const auto& temp =
+            m_temperature.state(amr_wind::field_impl::phi_state(fstate))(lev)
+                .const_array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                src_term(i, j, k) += 2.0 - 0.5 * (temp(i, j, k) - 300.0);
+            });
+    }
+
+    int fused_num_inputs() const override { return 1; }
+
+    void add_fused_form(
+        const int lev,
+        const amrex::MFIter& mfi,
+        const amr_wind::FieldState fstate,
+        amr_wind::pde::FusedSource& form) const override
+    {
+        const int idx = form.add_input(
+            m_temperature.state(amr_wind::field_impl::phi_state(fstate))(lev)
+                .const_array(mfi));
+        form.constant[0] += 2.0;
+        form.coeff(idx, 0, 0) = -0.5;
+        form.offset(idx, 0) = 300.0;
+    }
+
+private:
+    const amr_wind::Field& m_temperature;
+};
+
+//! Temperature source evaluated through its own kernel
+class UnfusedTempSrc
+    : public amr_wind::pde::TemperatureSource::Register<UnfusedTempSrc>
+{
+public:
+    static std::string identifier() { return "UnfusedTempSrc"; }
+
+    explicit UnfusedTempSrc(const amr_wind::CFDSim& /*unused*/) {}
+
+    void operator()(
+        const int /*lev*/,
+        const amrex::MFIter& /*mfi*/,
+        const amrex::Box& bx,
+        const amr_wind::FieldState /*fstate*/,
+        const amrex::Array4<amrex::Real>& src_term) const override
+    {
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                src_term(i, j, k) += 0.1 * i - 0.2 * k;
+            });
+    }
+};
+
+//! Maximum difference between two fields over all levels and components
+amrex::Real max_field_diff(
+    amr_wind::Field& lhs, amr_wind::ScratchField& rhs, const int ncomp)
+{
+    amrex::Real max_diff = 0.0;
+    for (int lev = 0; lev < rhs.repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Subtract(rhs(lev), lhs(lev), 0, 0, ncomp, 0);
+        for (int n = 0; n < ncomp; ++n) {
+            max_diff = amrex::max(max_diff, rhs(lev).norm0(n));
+        }
+    }
+    return max_diff;
+}
+
+} // namespace
+
+TEST_F(ABLMeshTest, fused_source_term_op)
+{
+    constexpr int kdim = 7;
+    constexpr amrex::Real tol = 1.0e-12;
+
+    utils::populate_abl_params();
+    {
+        amrex::ParmParse pp("ICNS");
+        amrex::Vector<std::string> srcs{
+            "BoussinesqBuoyancy", "DensityBuoyancy", "CoriolisForcing"};
+        pp.addarr("source_terms", srcs);
+    }
+    {
+        amrex::ParmParse pp("Temperature");
+        amrex::Vector<std::string> srcs{"UnfusedTempSrc", "FusedTempSrc"};
+        pp.addarr("source_terms", srcs);
+    }
+    initialize_mesh();
+
+    auto& pde_mgr = sim().pde_manager();
+    auto& icns = pde_mgr.register_icns();
+    auto& teqn = pde_mgr.register_transport_pde("Temperature");
+    sim().init_physics();
+
+    const auto fstate = amr_wind::FieldState::New;
+    auto& velocity = sim().repo().get_field("velocity");
+    auto& temperature = sim().repo().get_field("temperature");
+    auto& density = sim().repo().get_field("density");
+    auto& grad_p = sim().repo().get_field("gp");
+    run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto bx = mfi.validbox();
+        const auto& vel_arr = velocity(lev).array(mfi);
+        const auto& gp_arr = grad_p(lev).array(mfi);
+
+        init_abl_temperature_field(kdim, bx, temperature(lev).array(mfi));
+        init_density_field(kdim, bx, density(lev).array(mfi));
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                vel_arr(i, j, k, 0) = 10.0 + 0.1 * i - 0.2 * k;
+                vel_arr(i, j, k, 1) = -5.0 + 0.3 * j;
+                vel_arr(i, j, k, 2) = 0.5 * k - 0.1 * i;
+                gp_arr(i, j, k, 0) = 0.2 * k;
+                gp_arr(i, j, k, 1) = -0.1 * i;
+                gp_arr(i, j, k, 2) = 0.3;
+            });
+    });
+
+    // Momentum: the fused sources are folded into the pressure gradient
+    // kernel and the unfused source is added afterwards
+    {
+        amr_wind::pde::SrcTermOp<amr_wind::pde::ICNS> src_op(icns.fields());
+        src_op.init_source_terms(sim());
+        EXPECT_EQ(src_op.sources.size(), 3);
+        EXPECT_EQ(src_op.fused_sources.size(), 2);
+        EXPECT_EQ(src_op.unfused_sources.size(), 1);
+        src_op(fstate, false);
+
+        auto ref = sim().repo().create_scratch_field(AMREX_SPACEDIM);
+        run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto bx = mfi.validbox();
+            const auto& ref_arr = (*ref)(lev).array(mfi);
+            const auto& gp_arr = grad_p(lev).const_array(mfi);
+            const auto& rho = density(lev).const_array(mfi);
+            amrex::ParallelFor(
+                bx, AMREX_SPACEDIM,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    ref_arr(i, j, k, n) = -gp_arr(i, j, k, n) / rho(i, j, k);
+                });
+            for (const auto& src : src_op.sources) {
+                (*src)(lev, mfi, bx, fstate, ref_arr);
+            }
+        });
+        EXPECT_NEAR(
+            max_field_diff(icns.fields().src_term, *ref, AMREX_SPACEDIM), 0.0,
+            tol);
+    }
+
+    // Scalar: the fused sources and the density multiplication are applied
+    // in a single kernel after the unfused sources
+    {
+        amr_wind::pde::SrcTermOp<amr_wind::pde::Temperature> src_op(
+            teqn.fields());
+        src_op.init_source_terms(sim());
+        EXPECT_EQ(src_op.fused_sources.size(), 1);
+        EXPECT_EQ(src_op.unfused_sources.size(), 1);
+        src_op(fstate, false);
+
+        auto ref = sim().repo().create_scratch_field(1);
+        run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto bx = mfi.validbox();
+            const auto& ref_arr = (*ref)(lev).array(mfi);
+            const auto& rho = density(lev).const_array(mfi);
+            (*ref)(lev)[mfi].setVal<amrex::RunOn::Device>(0.0, bx);
+            for (const auto& src : src_op.sources) {
+                (*src)(lev, mfi, bx, fstate, ref_arr);
+            }
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    ref_arr(i, j, k) *= rho(i, j, k);
+                });
+        });
+        EXPECT_NEAR(max_field_diff(teqn.fields().src_term, *ref, 1), 0.0, tol);
+    }
+}
+
 } // namespace amr_wind_tests